@@ -0,0 +1,258 @@
+#ifndef POOL_ALLOCATOR
+#define POOL_ALLOCATOR
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace ft {
+    // The state pool_allocator copies share, rebound copies included: one
+    // pool of fixed-size slots per slot size, each carved from slabs that
+    // double up to max_slab slots, with freed slots kept on an intrusive
+    // free list. Nothing goes back to the system until the last copy does.
+    class pool_arena {
+    public:
+        struct free_slot {
+            free_slot *next;
+        };
+
+        struct pool {
+            char *slabs;
+            char *cur;
+            char *end;
+            free_slot *free_list;
+            std::size_t next_slab;
+            std::size_t stride;
+            pool *next;
+        };
+
+    private:
+        static const std::size_t first_slab = 32;
+        static const std::size_t max_slab = 65536;
+
+        pool *_pools;
+        std::size_t _refs;
+
+        pool_arena(const pool_arena &);
+        pool_arena &operator=(const pool_arena &);
+
+        static void add_slab(pool *p) {
+            std::size_t bytes = p->stride * (p->next_slab + 1);
+            char *slab = static_cast<char *>(::operator new(bytes));
+
+            *reinterpret_cast<char **>(slab) = p->slabs;
+            p->slabs = slab;
+            p->cur = slab + p->stride;
+            p->end = slab + bytes;
+            if (p->next_slab < max_slab)
+                p->next_slab *= 2;
+        }
+
+    public:
+        pool_arena() : _pools(0), _refs(1) {}
+
+        ~pool_arena() {
+            pool *cur = this->_pools;
+
+            while (cur != 0) {
+                pool *next = cur->next;
+                char *slab = cur->slabs;
+
+                while (slab != 0) {
+                    char *next_slab = *reinterpret_cast<char **>(slab);
+                    ::operator delete(slab);
+                    slab = next_slab;
+                }
+                delete cur;
+                cur = next;
+            }
+        }
+
+        void retain() {
+            this->_refs++;
+        }
+
+        // Drops a reference and returns how many are left.
+        std::size_t release() {
+            return (--this->_refs);
+        }
+
+        // The pool of stride-byte slots, created on first use.
+        pool *pool_for(std::size_t stride) {
+            for (pool *cur = this->_pools; cur != 0; cur = cur->next) {
+                if (cur->stride == stride)
+                    return (cur);
+            }
+            pool *p = new pool;
+            p->slabs = 0;
+            p->cur = 0;
+            p->end = 0;
+            p->free_list = 0;
+            p->next_slab = first_slab;
+            p->stride = stride;
+            p->next = this->_pools;
+            this->_pools = p;
+            return (p);
+        }
+
+        static void *allocate(pool *p) {
+            if (p->free_list != 0) {
+                free_slot *slot = p->free_list;
+                p->free_list = slot->next;
+                return (slot);
+            }
+            if (p->cur == p->end)
+                add_slab(p);
+            void *slot = p->cur;
+            p->cur += p->stride;
+            return (slot);
+        }
+
+        static void deallocate(pool *p, void *ptr) {
+            free_slot *slot = static_cast<free_slot *>(ptr);
+
+            slot->next = p->free_list;
+            p->free_list = slot;
+        }
+    };
+
+    // Hands out single objects from a pool_arena. Copies and rebound copies
+    // share the arena, so an allocator taken from a container reaches the
+    // same pools as its nodes, but a container's copy starts an arena of its
+    // own (see select_on_container_copy_construction). An arena is not safe
+    // to use from several threads at once. Requests for more than one object
+    // go straight to operator new, so the allocator stays usable for array
+    // containers.
+    template<class T>
+    class pool_allocator {
+    public:
+        typedef T value_type;
+        typedef T *pointer;
+        typedef const T *const_pointer;
+        typedef T &reference;
+        typedef const T &const_reference;
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+        template<class U>
+        struct rebind {
+            typedef pool_allocator<U> other;
+        };
+
+    private:
+        struct align_probe {
+            char c;
+            T value;
+        };
+
+        pool_arena *_arena;
+        pool_arena::pool *_pool;
+
+        // Slots hold a T or a free list link, aligned for both.
+        static size_type stride() {
+            size_type size = sizeof(T) < sizeof(pool_arena::free_slot) ? sizeof(pool_arena::free_slot) : sizeof(T);
+            size_type align = sizeof(align_probe) - sizeof(T);
+
+            if (align < sizeof(pool_arena::free_slot))
+                align = sizeof(pool_arena::free_slot);
+            return ((size + align - 1) / align * align);
+        }
+
+        pool_arena::pool *slots() {
+            if (this->_pool == 0)
+                this->_pool = this->_arena->pool_for(stride());
+            return (this->_pool);
+        }
+
+        void release() {
+            size_type refs = this->_arena->release();
+
+            if (refs == 0)
+                delete this->_arena;
+        }
+
+    public:
+        pool_allocator() : _arena(new pool_arena), _pool(0) {}
+
+        pool_allocator(const pool_allocator &copy) : _arena(copy._arena), _pool(copy._pool) {
+            this->_arena->retain();
+        }
+
+        template<class U>
+        pool_allocator(const pool_allocator<U> &copy) : _arena(copy._arena), _pool(0) {
+            this->_arena->retain();
+        }
+
+        pool_allocator &operator=(const pool_allocator &copy) {
+            if (this->_arena == copy._arena)
+                return (*this);
+            copy._arena->retain();
+            release();
+            this->_arena = copy._arena;
+            this->_pool = copy._pool;
+            return (*this);
+        }
+
+        ~pool_allocator() {
+            release();
+        }
+
+        // What a copied container allocates with: a fresh arena, so copies
+        // never share an unlocked pool behind the user's back.
+        pool_allocator select_on_container_copy_construction() const {
+            return (pool_allocator());
+        }
+
+        pointer address(reference x) const {
+            return (&x);
+        }
+
+        const_pointer address(const_reference x) const {
+            return (&x);
+        }
+
+        pointer allocate(size_type n, const void * = 0) {
+            if (n != 1)
+                return (static_cast<pointer>(::operator new(n * sizeof(T))));
+            return (static_cast<pointer>(pool_arena::allocate(slots())));
+        }
+
+        void deallocate(pointer p, size_type n) {
+            if (n != 1) {
+                ::operator delete(p);
+                return;
+            }
+            pool_arena::deallocate(slots(), p);
+        }
+
+        size_type max_size() const {
+            return (std::numeric_limits<size_type>::max() / sizeof(T));
+        }
+
+        void construct(pointer p, const_reference val) {
+            new(static_cast<void *>(p)) T(val);
+        }
+
+        void destroy(pointer p) {
+            p->~T();
+        }
+
+        template<class U>
+        friend class pool_allocator;
+
+        template<class A, class B>
+        friend bool operator==(const pool_allocator<A> &lhs, const pool_allocator<B> &rhs);
+    };
+
+    template<class A, class B>
+    bool operator==(const pool_allocator<A> &lhs, const pool_allocator<B> &rhs) {
+        return (lhs._arena == rhs._arena);
+    }
+
+    template<class A, class B>
+    bool operator!=(const pool_allocator<A> &lhs, const pool_allocator<B> &rhs) {
+        return (!(lhs == rhs));
+    }
+}
+
+#endif
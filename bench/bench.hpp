@@ -0,0 +1,61 @@
+#ifndef BENCH
+#define BENCH
+
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+
+namespace bench {
+    inline double now() {
+        struct timeval tv;
+
+        gettimeofday(&tv, 0);
+        return (tv.tv_sec + tv.tv_usec / 1000000.0);
+    }
+
+    class timer {
+    private:
+        double _start;
+
+    public:
+        timer() : _start(now()) {}
+
+        void reset() {
+            this->_start = now();
+        }
+
+        double elapsed() const {
+            return (now() - this->_start);
+        }
+    };
+
+    inline void report(const char *name, const char *impl, double sec, unsigned long ops) {
+        std::cout << std::left << std::setw(28) << name
+                  << std::setw(10) << impl
+                  << std::right << std::fixed << std::setprecision(4)
+                  << std::setw(10) << sec << " s"
+                  << std::setw(12) << std::setprecision(1)
+                  << (sec > 0 ? ops / sec / 1000000.0 : 0) << " Mops/s" << std::endl;
+    }
+
+    inline long peak_rss_kb() {
+        struct rusage usage;
+
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return (usage.ru_maxrss / 1024);
+#else
+        return (usage.ru_maxrss);
+#endif
+    }
+
+    inline unsigned long arg_or(int argc, char **argv, int idx, unsigned long def) {
+        if (argc > idx)
+            return (strtoul(argv[idx], 0, 10));
+        return (def);
+    }
+}
+
+#endif
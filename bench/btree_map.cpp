@@ -0,0 +1,97 @@
+#include <sstream>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "../map/map.hpp"
+#include "../btree_map/btree_map.hpp"
+
+// usage: ./bench/btree_map [max entries] [lookups]
+// Replays the main.cpp map load (random inserts, operator[] lookups, a copy)
+// plus iteration and erase, for int and std::string keys. Lookups hit present
+// keys so both maps keep the same size throughout. Sizes grow tenfold from 1K
+// up to max entries.
+template<class Key>
+Key make_key(int n);
+
+template<>
+int make_key<int>(int n) {
+    return (n);
+}
+
+template<>
+std::string make_key<std::string>(int n) {
+    std::ostringstream out;
+
+    out << "key-" << n;
+    return (out.str());
+}
+
+template<class Map>
+long run(const char *impl, const std::vector<typename Map::key_type> &keys,
+         const std::vector<typename Map::key_type> &probes) {
+    long sum = 0;
+    Map m;
+    bench::timer t;
+    for (unsigned long i = 0; i < keys.size(); i++)
+        m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+    bench::report("random insert", impl, t.elapsed(), keys.size());
+
+    t.reset();
+    for (unsigned long i = 0; i < probes.size(); i++)
+        sum += m[probes[i]];
+    bench::report("operator[]", impl, t.elapsed(), probes.size());
+
+    t.reset();
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+    bench::report("iterate", impl, t.elapsed(), m.size());
+
+    t.reset();
+    {
+        Map copy(m);
+        sum += copy.size();
+    }
+    bench::report("copy + destroy", impl, t.elapsed(), m.size());
+
+    t.reset();
+    for (unsigned long i = 0; i < keys.size(); i += 2)
+        m.erase(keys[i]);
+    bench::report("erase half", impl, t.elapsed(), keys.size() / 2);
+    sum += m.size();
+    return (sum);
+}
+
+template<class Key>
+bool compare(const char *label, unsigned long max_entries, unsigned long lookups) {
+    for (unsigned long entries = 1000; entries <= max_entries; entries *= 10) {
+        std::vector<Key> keys;
+        std::vector<Key> probes;
+
+        keys.reserve(entries);
+        for (unsigned long i = 0; i < entries; i++)
+            keys.push_back(make_key<Key>(rand()));
+        probes.reserve(lookups);
+        for (unsigned long i = 0; i < lookups; i++)
+            probes.push_back(keys[rand() % entries]);
+
+        std::cout << label << " keys, entries: " << entries << ", lookups: " << lookups << std::endl;
+        long a = run<ft::map<Key, int> >("map", keys, probes);
+        long b = run<ft::btree_map<Key, int> >("btree_map", keys, probes);
+        if (a != b)
+            return (false);
+    }
+    return (true);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long max_entries = bench::arg_or(argc, argv, 1, 1000000);
+    const unsigned long lookups = bench::arg_or(argc, argv, 2, 1000000);
+
+    srand(42);
+    if (!compare<int>("int", max_entries, lookups)
+        || !compare<std::string>("string", max_entries, lookups)) {
+        std::cerr << "Error: results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
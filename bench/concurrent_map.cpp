@@ -0,0 +1,135 @@
+#include <pthread.h>
+#include <unistd.h>
+#include <sstream>
+#include <string>
+#include "bench.hpp"
+#include "../map/map.hpp"
+#include "../concurrent_map/concurrent_map.hpp"
+
+// usage: ./bench/concurrent_map [max threads] [entries] [ops per thread]
+// Every thread runs the same mix of finds, inserts and erases over a key
+// range preloaded to half full, at 100%, 90% and 50% reads. The baseline is
+// the current setup: one ft::map behind one pthread mutex.
+class locked_map {
+private:
+    ft::map<int, int> _map;
+    pthread_mutex_t _mutex;
+
+public:
+    locked_map() {
+        pthread_mutex_init(&this->_mutex, 0);
+    }
+
+    ~locked_map() {
+        pthread_mutex_destroy(&this->_mutex);
+    }
+
+    bool find(int k, int &out) {
+        pthread_mutex_lock(&this->_mutex);
+        ft::map<int, int>::iterator it = this->_map.find(k);
+        bool found = it != this->_map.end();
+        if (found)
+            out = it->second;
+        pthread_mutex_unlock(&this->_mutex);
+        return (found);
+    }
+
+    bool insert(const ft::pair<const int, int> &val) {
+        pthread_mutex_lock(&this->_mutex);
+        bool inserted = this->_map.insert(val).second;
+        pthread_mutex_unlock(&this->_mutex);
+        return (inserted);
+    }
+
+    unsigned long erase(int k) {
+        pthread_mutex_lock(&this->_mutex);
+        unsigned long erased = this->_map.erase(k);
+        pthread_mutex_unlock(&this->_mutex);
+        return (erased);
+    }
+};
+
+template<class Map>
+struct job {
+    Map *map;
+    unsigned int seed;
+    int range;
+    int read_percent;
+    unsigned long ops;
+    long sum;
+};
+
+template<class Map>
+void *work(void *arg) {
+    job<Map> *j = static_cast<job<Map> *>(arg);
+
+    for (unsigned long i = 0; i < j->ops; i++) {
+        int r = rand_r(&j->seed);
+        int k = rand_r(&j->seed) % j->range;
+        int v;
+
+        if (r % 100 < j->read_percent) {
+            if (j->map->find(k, v))
+                j->sum += v;
+        } else if (r & 1) {
+            j->map->insert(ft::make_pair(k, k));
+        } else {
+            j->map->erase(k);
+        }
+    }
+    return (0);
+}
+
+template<class Map>
+long run(const char *impl, int threads, int range, int read_percent, unsigned long ops) {
+    Map m;
+    job<Map> jobs[256];
+    pthread_t tids[256];
+    long sum = 0;
+
+    for (int k = 0; k < range; k += 2)
+        m.insert(ft::make_pair(k, k));
+    for (int i = 0; i < threads; i++) {
+        jobs[i].map = &m;
+        jobs[i].seed = 42 + i;
+        jobs[i].range = range;
+        jobs[i].read_percent = read_percent;
+        jobs[i].ops = ops;
+        jobs[i].sum = 0;
+    }
+    bench::timer t;
+    for (int i = 0; i < threads; i++)
+        pthread_create(&tids[i], 0, work<Map>, &jobs[i]);
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], 0);
+        sum += jobs[i].sum;
+    }
+    std::ostringstream name;
+    name << read_percent << "% reads, " << threads << (threads == 1 ? " thread" : " threads");
+    bench::report(name.str().c_str(), impl, t.elapsed(), ops * threads);
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    const unsigned long max_threads = bench::arg_or(argc, argv, 1, cpus > 0 ? cpus : 4);
+    const unsigned long entries = bench::arg_or(argc, argv, 2, 1000000);
+    const unsigned long ops = bench::arg_or(argc, argv, 3, 1000000);
+    const int read_percents[] = {100, 90, 50};
+
+    std::cout << "entries: " << entries << ", ops per thread: " << ops << std::endl;
+    for (unsigned long p = 0; p < sizeof(read_percents) / sizeof(read_percents[0]); p++) {
+        for (unsigned long threads = 1; threads <= max_threads && threads <= 256;
+             threads = threads < max_threads && threads * 2 > max_threads ? max_threads : threads * 2) {
+            int range = static_cast<int>(entries);
+            long a = run<locked_map>("mutex", threads, range, read_percents[p], ops);
+            long b = run<ft::concurrent_map<int, int> >("skiplist", threads, range, read_percents[p], ops);
+            // Only a read-only run has one right answer.
+            if (read_percents[p] == 100 && a != b) {
+                std::cerr << "Error: lookup results differ" << std::endl;
+                return (1);
+            }
+        }
+    }
+    return (0);
+}
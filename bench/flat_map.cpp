@@ -0,0 +1,57 @@
+#include <vector>
+#include "bench.hpp"
+#include "../map/map.hpp"
+#include "../flat_map/flat_map.hpp"
+
+// usage: ./bench/flat_map [max entries] [lookups]
+// Sizes grow tenfold from 1K up to max entries (default 10M; pass 100000000
+// for 100M, which needs several GB for ft::map).
+template<class Map>
+long run(const char *impl, const std::vector<ft::pair<int, int> > &items, const int *keys, unsigned long lookups) {
+    long sum = 0;
+    bench::timer t;
+    Map m(items.begin(), items.end());
+    bench::report("sorted load", impl, t.elapsed(), m.size());
+
+    t.reset();
+    for (unsigned long i = 0; i < lookups; i++) {
+        typename Map::const_iterator it = m.find(keys[i]);
+        if (it != m.end())
+            sum += it->second;
+    }
+    bench::report("find", impl, t.elapsed(), lookups);
+
+    t.reset();
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+    bench::report("iterate", impl, t.elapsed(), m.size());
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long max_entries = bench::arg_or(argc, argv, 1, 10000000);
+    const unsigned long lookups = bench::arg_or(argc, argv, 2, 1000000);
+    int *keys = new int[lookups];
+
+    srand(42);
+    for (unsigned long entries = 1000; entries <= max_entries; entries *= 10) {
+        std::vector<ft::pair<int, int> > items;
+
+        items.reserve(entries);
+        for (unsigned long i = 0; i < entries; i++)
+            items.push_back(ft::make_pair(static_cast<int>(i * 2), rand()));
+        for (unsigned long i = 0; i < lookups; i++)
+            keys[i] = rand() % static_cast<int>(entries * 2);
+
+        std::cout << "entries: " << entries << ", lookups: " << lookups << std::endl;
+        long a = run<ft::map<int, int> >("map", items, keys, lookups);
+        long b = run<ft::flat_map<int, int> >("flat_map", items, keys, lookups);
+        if (a != b) {
+            delete[] keys;
+            std::cerr << "Error: lookup results differ" << std::endl;
+            return (1);
+        }
+    }
+    delete[] keys;
+    return (0);
+}
@@ -0,0 +1,44 @@
+#include <map>
+#include "bench.hpp"
+#include "../map/map.hpp"
+
+// usage: ./bench/map_copy [entries]
+template<class Map>
+long run_copy(const char *impl, const Map &m) {
+    long sum = 0;
+    bench::timer t;
+    {
+        Map copy(m);
+        bench::report("copy construct", impl, t.elapsed(), m.size());
+        sum += copy.size();
+
+        t.reset();
+        copy = m;
+        bench::report("copy assign (same size)", impl, t.elapsed(), m.size());
+        sum += copy.begin()->second;
+    }
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+    ft::map<int, int> ft_map;
+    std::map<int, int> std_map;
+
+    srand(42);
+    for (unsigned long i = 0; i < entries; i++) {
+        int k = rand();
+        int v = rand();
+        ft_map.insert(ft::make_pair(k, v));
+        std_map.insert(std::make_pair(k, v));
+    }
+
+    std::cout << "entries: " << ft_map.size() << std::endl;
+    long a = run_copy("ft", ft_map);
+    long b = run_copy("std", std_map);
+    if (a != b) {
+        std::cerr << "Error: copy results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
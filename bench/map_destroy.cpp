@@ -0,0 +1,35 @@
+#include <map>
+#include "bench.hpp"
+#include "../map/map.hpp"
+
+// usage: ./bench/map_destroy [entries]
+template<class Map>
+void run_destroy(const char *impl, unsigned long entries) {
+    Map *m = new Map;
+
+    srand(42);
+    for (unsigned long i = 0; i < entries; i++)
+        (*m)[rand()] = static_cast<int>(i);
+    unsigned long size = m->size();
+
+    bench::timer t;
+    delete m;
+    bench::report("destroy", impl, t.elapsed(), size);
+
+    Map reused;
+    for (unsigned long i = 0; i < entries; i++)
+        reused[rand()] = static_cast<int>(i);
+    size = reused.size();
+    t.reset();
+    reused.clear();
+    bench::report("clear", impl, t.elapsed(), size);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+
+    std::cout << "entries: " << entries << std::endl;
+    run_destroy<ft::map<int, int> >("ft", entries);
+    run_destroy<std::map<int, int> >("std", entries);
+    return (0);
+}
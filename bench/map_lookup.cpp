@@ -0,0 +1,48 @@
+#include <map>
+#include "bench.hpp"
+#include "../map/map.hpp"
+
+// usage: ./bench/map_lookup [entries] [lookups]
+template<class Map>
+long run_lookup(const char *impl, const Map &m, const int *keys, unsigned long lookups) {
+    bench::timer t;
+    long found = 0;
+
+    for (unsigned long i = 0; i < lookups; i++) {
+        found += m.count(keys[i]);
+        typename Map::const_iterator it = m.find(keys[i]);
+        if (it != m.end())
+            found += it->second;
+    }
+    bench::report("find + count", impl, t.elapsed(), lookups * 2);
+    return (found);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+    const unsigned long lookups = bench::arg_or(argc, argv, 2, 10000);
+    ft::map<int, int> ft_map;
+    std::map<int, int> std_map;
+
+    srand(42);
+    for (unsigned long i = 0; i < entries; i++) {
+        int k = rand();
+        int v = rand();
+        ft_map.insert(ft::make_pair(k, v));
+        std_map.insert(std::make_pair(k, v));
+    }
+
+    int *keys = new int[lookups];
+    for (unsigned long i = 0; i < lookups; i++)
+        keys[i] = rand();
+
+    std::cout << "entries: " << ft_map.size() << ", lookups: " << lookups << std::endl;
+    long a = run_lookup("ft", ft_map, keys, lookups);
+    long b = run_lookup("std", std_map, keys, lookups);
+    delete[] keys;
+    if (a != b) {
+        std::cerr << "Error: lookup results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
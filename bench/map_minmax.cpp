@@ -0,0 +1,43 @@
+#include <map>
+#include "bench.hpp"
+#include "../map/map.hpp"
+
+// usage: ./bench/map_minmax [entries] [pops]
+// Priority-queue style workload: repeatedly peek at both ends, pop the
+// smallest key and push a new one.
+template<class Map>
+long run_queue(const char *impl, Map &m, unsigned long pops) {
+    bench::timer t;
+    long sum = 0;
+    int next = static_cast<int>(m.size());
+
+    for (unsigned long i = 0; i < pops; i++) {
+        sum += m.begin()->first;
+        sum += m.rbegin()->first;
+        m.erase(m.begin());
+        m[next++] = static_cast<int>(i);
+    }
+    bench::report("pop min / peek max / push", impl, t.elapsed(), pops);
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+    const unsigned long pops = bench::arg_or(argc, argv, 2, 1000000);
+    ft::map<int, int> ft_map;
+    std::map<int, int> std_map;
+
+    for (unsigned long i = 0; i < entries; i++) {
+        ft_map[static_cast<int>(i)] = 0;
+        std_map[static_cast<int>(i)] = 0;
+    }
+
+    std::cout << "entries: " << entries << ", pops: " << pops << std::endl;
+    long a = run_queue("ft", ft_map, pops);
+    long b = run_queue("std", std_map, pops);
+    if (a != b) {
+        std::cerr << "Error: queue results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
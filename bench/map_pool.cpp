@@ -0,0 +1,57 @@
+#include <unistd.h>
+#include <sys/wait.h>
+#include "bench.hpp"
+#include "../map/map.hpp"
+#include "../allocator/pool_allocator.hpp"
+
+// usage: ./bench/map_pool [entries]
+// Each allocator runs in its own child process so the peak RSS it reports
+// belongs to that run alone.
+template<class Map>
+void run_map(const char *impl, unsigned long entries) {
+    long before = bench::peak_rss_kb();
+    Map *m = new Map;
+    long sum = 0;
+
+    srand(42);
+    bench::timer t;
+    for (unsigned long i = 0; i < entries; i++)
+        m->insert(ft::make_pair(rand(), static_cast<int>(i)));
+    bench::report("insert", impl, t.elapsed(), entries);
+
+    t.reset();
+    for (unsigned long i = 0; i < entries; i++)
+        sum += m->count(rand());
+    bench::report("find", impl, t.elapsed(), entries);
+
+    long rss = bench::peak_rss_kb() - before;
+    unsigned long size = m->size();
+    t.reset();
+    delete m;
+    bench::report("destroy", impl, t.elapsed(), size);
+    std::cout << std::left << std::setw(28) << "peak rss" << std::setw(10) << impl
+              << std::right << std::setw(10) << rss << " KB"
+              << std::setw(12) << std::setprecision(1) << rss * 1024.0 / size << " B/entry"
+              << " (" << sum << " hits)" << std::endl;
+}
+
+template<class Map>
+void run_child(const char *impl, unsigned long entries) {
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        run_map<Map>(impl, entries);
+        exit(0);
+    }
+    waitpid(pid, 0, 0);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+
+    std::cout << "entries: " << entries
+              << ", node size: " << sizeof(ft::Node<ft::pair<const int, int> >) << " B" << std::endl;
+    run_child<ft::map<int, int> >("std", entries);
+    run_child<ft::map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > > >("pool", entries);
+    return (0);
+}
@@ -0,0 +1,110 @@
+#include <map>
+#include "bench.hpp"
+#include "../map/map.hpp"
+
+// usage: ./bench/map_setops [entries]
+// Runs every operation once with equal sizes and once per skew ratio, so the
+// linear walk and the per-element probing strategy both show up.
+typedef ft::map<int, int> ft_map_type;
+typedef std::map<int, int> std_map_type;
+
+void fill(ft_map_type &ft_map, std_map_type &std_map, unsigned long n, int range) {
+    for (unsigned long i = 0; i < n; i++) {
+        int k = rand() % range;
+        ft_map.insert(ft::make_pair(k, static_cast<int>(i)));
+        std_map.insert(std::make_pair(k, static_cast<int>(i)));
+    }
+}
+
+long run_ft(const ft_map_type &a, const ft_map_type &b) {
+    long sum = 0;
+    ft_map_type res(a);
+    bench::timer t;
+    res.set_union(b);
+    bench::report("union", "ft", t.elapsed(), a.size() + b.size());
+    sum += res.size();
+
+    res = a;
+    t.reset();
+    res.insert(b.begin(), b.end());
+    bench::report("union", "ft insert", t.elapsed(), a.size() + b.size());
+    if (res.size() != static_cast<unsigned long>(sum))
+        sum = -1;
+
+    res = a;
+    t.reset();
+    res.set_intersection(b);
+    bench::report("intersection", "ft", t.elapsed(), a.size() + b.size());
+    sum += res.size();
+
+    res = a;
+    t.reset();
+    res.set_difference(b);
+    bench::report("difference", "ft", t.elapsed(), a.size() + b.size());
+    sum += res.size();
+    return (sum);
+}
+
+long run_std(const std_map_type &a, const std_map_type &b) {
+    long sum = 0;
+    std_map_type res(a);
+    bench::timer t;
+    res.insert(b.begin(), b.end());
+    bench::report("union", "std", t.elapsed(), a.size() + b.size());
+    sum += res.size();
+
+    t.reset();
+    {
+        std_map_type tmp;
+        std_map_type::const_iterator first = a.begin();
+        std_map_type::const_iterator second = b.begin();
+        while (first != a.end() && second != b.end()) {
+            if (first->first < second->first) {
+                ++first;
+            } else if (second->first < first->first) {
+                ++second;
+            } else {
+                tmp.insert(tmp.end(), *first);
+                ++first;
+                ++second;
+            }
+        }
+        res.swap(tmp);
+    }
+    bench::report("intersection", "std", t.elapsed(), a.size() + b.size());
+    sum += res.size();
+
+    res = a;
+    t.reset();
+    for (std_map_type::const_iterator it = b.begin(); it != b.end(); ++it)
+        res.erase(it->first);
+    bench::report("difference", "std", t.elapsed(), a.size() + b.size());
+    sum += res.size();
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+    const unsigned long ratios[] = {1, 10, 1000, 100000};
+
+    srand(42);
+    for (unsigned long i = 0; i < sizeof(ratios) / sizeof(ratios[0]); i++) {
+        unsigned long small = entries / ratios[i];
+        int range = static_cast<int>(entries * 2);
+        ft_map_type ft_a, ft_b;
+        std_map_type std_a, std_b;
+
+        if (small == 0)
+            continue;
+        fill(ft_a, std_a, entries, range);
+        fill(ft_b, std_b, small, range);
+        std::cout << "sizes: " << ft_a.size() << " x " << ft_b.size() << std::endl;
+        long a = run_ft(ft_a, ft_b);
+        long b = run_std(std_a, std_b);
+        if (a != b) {
+            std::cerr << "Error: set operation results differ" << std::endl;
+            return (1);
+        }
+    }
+    return (0);
+}
@@ -0,0 +1,93 @@
+#include <memory>
+#include <vector>
+#include "bench.hpp"
+#include "../map/map.hpp"
+#include "../persistent_map/persistent_map.hpp"
+
+// usage: ./bench/persistent_map [entries] [rounds] [writes per round]
+// The main.cpp pattern: copy a large map to read a consistent view while the
+// original keeps changing. Each round takes a copy, writes to the original,
+// then reads the copy; the last eight copies stay alive, and the bytes held
+// by all nodes are reported at the end.
+static unsigned long live_bytes = 0;
+
+template<class T>
+class counting_allocator : public std::allocator<T> {
+public:
+    template<class U>
+    struct rebind {
+        typedef counting_allocator<U> other;
+    };
+
+    counting_allocator() {}
+
+    template<class U>
+    counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(std::size_t n, const void * = 0) {
+        live_bytes += n * sizeof(T);
+        return (std::allocator<T>::allocate(n));
+    }
+
+    void deallocate(T *p, std::size_t n) {
+        live_bytes -= n * sizeof(T);
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+typedef counting_allocator<ft::pair<const int, int> > alloc_type;
+
+template<class Map>
+long run(const char *impl, const std::vector<int> &keys, unsigned long rounds, unsigned long writes) {
+    long sum = 0;
+    unsigned long base = live_bytes;
+    double copy_sec = 0;
+    double write_sec = 0;
+    double read_sec = 0;
+    std::vector<Map> kept(8);
+    Map m;
+
+    for (unsigned long i = 0; i < keys.size(); i++)
+        m[keys[i]] = static_cast<int>(i);
+    for (unsigned long r = 0; r < rounds; r++) {
+        bench::timer t;
+        Map view = m;
+        copy_sec += t.elapsed();
+
+        t.reset();
+        for (unsigned long w = 0; w < writes; w++)
+            m[keys[(r * writes + w) % keys.size()]] += 1;
+        write_sec += t.elapsed();
+
+        t.reset();
+        for (unsigned long w = 0; w < writes; w++)
+            sum += view.find(keys[(r * writes + w) % keys.size()])->second;
+        read_sec += t.elapsed();
+        kept[r % kept.size()] = view;
+    }
+    bench::report("copy", impl, copy_sec, rounds);
+    bench::report("write after copy", impl, write_sec, rounds * writes);
+    bench::report("read copy", impl, read_sec, rounds * writes);
+    std::cout << "  " << impl << " node bytes with 8 copies alive: " << (live_bytes - base) / 1024 << " KB" << std::endl;
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long entries = bench::arg_or(argc, argv, 1, 1000000);
+    const unsigned long rounds = bench::arg_or(argc, argv, 2, 100);
+    const unsigned long writes = bench::arg_or(argc, argv, 3, 1000);
+    std::vector<int> keys;
+
+    srand(42);
+    for (unsigned long i = 0; i < entries; i++)
+        keys.push_back(rand());
+
+    std::cout << "entries: " << entries << ", rounds: " << rounds << ", writes per round: " << writes << std::endl;
+    long a = run<ft::map<int, int, std::less<int>, alloc_type> >("map", keys, rounds, writes);
+    long b = run<ft::persistent_map<int, int, std::less<int>, alloc_type> >("persistent", keys, rounds, writes);
+    if (a != b) {
+        std::cerr << "Error: snapshot reads differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
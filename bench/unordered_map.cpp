@@ -0,0 +1,82 @@
+#include <vector>
+#include "bench.hpp"
+#include "../map/map.hpp"
+#include "../unordered_map/unordered_map.hpp"
+
+// usage: ./bench/unordered_map [max entries] [lookups]
+// The main.cpp map load with random int keys: rand() inserts, then
+// operator[] on present keys and find on fresh rand() keys, which mostly
+// miss. Sizes grow tenfold from 1K up to max entries.
+template<class Map>
+long lookups(const char *impl, Map &m, const std::vector<int> &hits, const std::vector<int> &probes) {
+    long sum = 0;
+    bench::timer t;
+    for (unsigned long i = 0; i < hits.size(); i++)
+        sum += m[hits[i]];
+    bench::report("operator[] hit", impl, t.elapsed(), hits.size());
+
+    t.reset();
+    for (unsigned long i = 0; i < probes.size(); i++) {
+        typename Map::const_iterator it = m.find(probes[i]);
+        if (it != m.end())
+            sum += it->second;
+    }
+    bench::report("find random", impl, t.elapsed(), probes.size());
+
+    t.reset();
+    for (typename Map::const_iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second;
+    bench::report("iterate", impl, t.elapsed(), m.size());
+    return (sum + m.size());
+}
+
+template<class Map>
+long run(const char *impl, const std::vector<int> &keys, const std::vector<int> &hits,
+         const std::vector<int> &probes) {
+    Map m;
+    bench::timer t;
+    for (unsigned long i = 0; i < keys.size(); i++)
+        m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+    bench::report("random insert", impl, t.elapsed(), keys.size());
+    return (lookups(impl, m, hits, probes));
+}
+
+long run_reserved(const char *impl, const std::vector<int> &keys, const std::vector<int> &hits,
+                  const std::vector<int> &probes) {
+    ft::unordered_map<int, int> m;
+    bench::timer t;
+    m.reserve(keys.size());
+    for (unsigned long i = 0; i < keys.size(); i++)
+        m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+    bench::report("random insert", impl, t.elapsed(), keys.size());
+    return (lookups(impl, m, hits, probes));
+}
+
+int main(int argc, char **argv) {
+    const unsigned long max_entries = bench::arg_or(argc, argv, 1, 10000000);
+    const unsigned long count = bench::arg_or(argc, argv, 2, 1000000);
+
+    srand(42);
+    for (unsigned long entries = 1000; entries <= max_entries; entries *= 10) {
+        std::vector<int> keys;
+        std::vector<int> hits;
+        std::vector<int> probes;
+
+        for (unsigned long i = 0; i < entries; i++)
+            keys.push_back(rand());
+        for (unsigned long i = 0; i < count; i++) {
+            hits.push_back(keys[rand() % entries]);
+            probes.push_back(rand());
+        }
+
+        std::cout << "entries: " << entries << ", lookups: " << count << std::endl;
+        long a = run<ft::map<int, int> >("map", keys, hits, probes);
+        long b = run<ft::unordered_map<int, int> >("unordered", keys, hits, probes);
+        long c = run_reserved("reserved", keys, hits, probes);
+        if (a != b || a != c) {
+            std::cerr << "Error: lookup results differ" << std::endl;
+            return (1);
+        }
+    }
+    return (0);
+}
@@ -0,0 +1,130 @@
+#include <cstring>
+#include <vector>
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+
+// usage: ./bench/vector_fill [buffers] [bytes]
+// Fills a vector with data that overwrites every element, the way a read
+// from disk or the network would: main.cpp's push_back(Buffer()) loop,
+// resize with a value, and append(n, default_init), which leaves the
+// elements uninitialized and hands them back to be written once. "std" is
+// std::vector::resize, which zeroes them first. The char ops are bytes.
+struct Buffer {
+    int idx;
+    char buff[4096];
+};
+
+void fill_buffer(Buffer &b, unsigned long i) {
+    b.idx = static_cast<int>(i);
+    std::memset(b.buff, static_cast<int>(i & 0x7f), sizeof(b.buff));
+}
+
+template<class Vector>
+long checksum(const Vector &v) {
+    long sum = 0;
+
+    for (unsigned long i = 0; i < v.size(); i += 61)
+        sum += v[i].idx + v[i].buff[i % sizeof(v[i].buff)];
+    return (sum);
+}
+
+long buffers_push_back(unsigned long count) {
+    bench::timer t;
+    ft::vector<Buffer> v;
+
+    for (unsigned long i = 0; i < count; i++) {
+        v.push_back(Buffer());
+        fill_buffer(v.back(), i);
+    }
+    bench::report("Buffer fill", "push_back", t.elapsed(), count);
+    return (checksum(v));
+}
+
+long buffers_resize(unsigned long count) {
+    bench::timer t;
+    ft::vector<Buffer> v;
+
+    v.resize(count, Buffer());
+    for (unsigned long i = 0; i < count; i++)
+        fill_buffer(v[i], i);
+    bench::report("Buffer fill", "resize", t.elapsed(), count);
+    return (checksum(v));
+}
+
+long buffers_append(unsigned long count) {
+    bench::timer t;
+    ft::vector<Buffer> v;
+    ft::vector<Buffer>::iterator it = v.append(count, ft::default_init);
+
+    for (unsigned long i = 0; i < count; i++)
+        fill_buffer(it[i], i);
+    bench::report("Buffer fill", "append", t.elapsed(), count);
+    return (checksum(v));
+}
+
+long buffers_std(unsigned long count) {
+    bench::timer t;
+    std::vector<Buffer> v;
+
+    v.resize(count);
+    for (unsigned long i = 0; i < count; i++)
+        fill_buffer(v[i], i);
+    bench::report("Buffer fill", "std", t.elapsed(), count);
+    return (checksum(v));
+}
+
+template<class Vector>
+long bytes_sum(const Vector &v) {
+    long sum = 0;
+
+    for (unsigned long i = 0; i < v.size(); i += 4093)
+        sum += v[i];
+    return (sum);
+}
+
+template<class Vector>
+char *grow_resize(Vector &v, unsigned long n) {
+    v.resize(v.size() + n);
+    return (&v[v.size() - n]);
+}
+
+char *grow_append(ft::vector<char> &v, unsigned long n) {
+    return (&*v.append(n, ft::default_init));
+}
+
+// Reads count bytes into v in 64 KB chunks, growing it with grow as a read
+// loop would.
+template<class Vector>
+long bytes(const char *impl, char *(*grow)(Vector &, unsigned long), unsigned long count) {
+    const unsigned long chunk = 64 * 1024;
+    bench::timer t;
+    Vector v;
+
+    for (unsigned long done = 0; done < count; done += chunk) {
+        unsigned long n = count - done < chunk ? count - done : chunk;
+
+        std::memset(grow(v, n), static_cast<int>(done / chunk & 0x7f), n);
+    }
+    bench::report("char read 64KB chunks", impl, t.elapsed(), count);
+    return (bytes_sum(v));
+}
+
+int main(int argc, char **argv) {
+    const unsigned long buffers = bench::arg_or(argc, argv, 1, 200000);
+    const unsigned long bytes_count = bench::arg_or(argc, argv, 2, 1UL << 30);
+
+    std::cout << "buffers: " << buffers << ", bytes: " << bytes_count << std::endl;
+    long expected = buffers_std(buffers);
+    if (buffers_push_back(buffers) != expected || buffers_resize(buffers) != expected
+        || buffers_append(buffers) != expected) {
+        std::cerr << "Error: Buffer results differ" << std::endl;
+        return (1);
+    }
+    expected = bytes<std::vector<char> >("std", grow_resize, bytes_count);
+    if (bytes<ft::vector<char> >("resize", grow_resize, bytes_count) != expected
+        || bytes<ft::vector<char> >("append", grow_append, bytes_count) != expected) {
+        std::cerr << "Error: byte results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
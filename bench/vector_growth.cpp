@@ -0,0 +1,69 @@
+#include <unistd.h>
+#include <sys/wait.h>
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+
+// usage: ./bench/vector_growth [ints] [buffers]
+// push_back into an empty vector under each growth policy, for ints and for
+// main.cpp's 4 KB Buffer. Each run is its own child process so the peak RSS
+// it reports belongs to that run alone; "capacity" is what the vector ended
+// up reserving, touched or not.
+struct Buffer {
+    int idx;
+    char buff[4096];
+};
+
+typedef ft::growth_factor<2, 1> growth_2x;
+typedef ft::growth_factor<3, 2> growth_1_5x;
+typedef ft::growth_chunk<16 << 20> growth_16mb;
+typedef ft::growth_page<> growth_page_2x;
+
+template<class T, class Growth>
+void run(const char *name, const char *impl, unsigned long count) {
+    long before = bench::peak_rss_kb();
+    ft::vector<T, std::allocator<T>, Growth> v;
+    T val = T();
+    unsigned long reallocs = 0;
+
+    bench::timer t;
+    for (unsigned long i = 0; i < count; i++) {
+        if (v.size() == v.capacity())
+            reallocs++;
+        v.push_back(val);
+    }
+    double sec = t.elapsed();
+    bench::report(name, impl, sec, count);
+    std::cout << std::left << std::setw(28) << "  peak rss / capacity" << std::setw(10) << impl
+              << std::right << std::setw(10) << (bench::peak_rss_kb() - before) / 1024 << " MB"
+              << std::setw(10) << v.capacity() * sizeof(T) / (1024 * 1024) << " MB"
+              << std::setw(6) << reallocs << " reallocations" << std::endl;
+}
+
+template<class T, class Growth>
+void run_child(const char *name, const char *impl, unsigned long count) {
+    pid_t pid = fork();
+
+    if (pid == 0) {
+        run<T, Growth>(name, impl, count);
+        exit(0);
+    }
+    waitpid(pid, 0, 0);
+}
+
+template<class T>
+void compare(const char *name, unsigned long count) {
+    run_child<T, growth_2x>(name, "2x", count);
+    run_child<T, growth_1_5x>(name, "1.5x", count);
+    run_child<T, growth_16mb>(name, "16MB", count);
+    run_child<T, growth_page_2x>(name, "page 2x", count);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long ints = bench::arg_or(argc, argv, 1, 50000000);
+    const unsigned long buffers = bench::arg_or(argc, argv, 2, 100000);
+
+    std::cout << "ints: " << ints << ", buffers: " << buffers << std::endl;
+    compare<int>("int push_back", ints);
+    compare<Buffer>("Buffer push_back", buffers);
+    return (0);
+}
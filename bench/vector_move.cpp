@@ -0,0 +1,127 @@
+#include <vector>
+#include <string>
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../map/map.hpp"
+#include "../stack/stack.hpp"
+
+// usage: ./bench/vector_move [strings] [vectors]
+// Containers of heap-allocated strings and of nested vectors: growth,
+// inserts at the front, map inserts and stack pushes. Build once as C++98
+// and once as C++11 (make bench builds both) to compare copying with
+// moving; "std" is std::vector in the same build. Inserts at the front
+// count every element they shift as one op.
+#if FT_HAS_MOVE
+# define MODE "c++11"
+#else
+# define MODE "c++98"
+#endif
+
+std::string make_string(unsigned long i) {
+    std::string s(48, 'a' + static_cast<char>(i % 26));
+
+    s[0] = static_cast<char>('0' + i % 10);
+    return (s);
+}
+
+template<class Vector>
+long strings(const char *impl, unsigned long count) {
+    std::string s;
+    long sum = 0;
+    bench::timer t;
+    {
+        Vector v;
+
+        for (unsigned long i = 0; i < count; i++) {
+            s = make_string(i);
+            v.push_back(s);
+        }
+        bench::report("string push_back", impl, t.elapsed(), count);
+        sum += v[count / 2][0] + static_cast<long>(v.size());
+    }
+
+    Vector v;
+    unsigned long front = count / 100;
+    unsigned long shifted = 0;
+    t.reset();
+    for (unsigned long i = 0; i < front; i++) {
+        s = make_string(i);
+        shifted += v.size();
+        v.insert(v.begin(), s);
+    }
+    bench::report("string insert front", impl, t.elapsed(), shifted);
+    for (unsigned long i = 0; i < v.size(); i += 7)
+        sum += v[i][0];
+    return (sum);
+}
+
+template<class Vector>
+long nested(const char *impl, unsigned long count) {
+    typedef typename Vector::value_type inner_type;
+    inner_type inner;
+    long sum = 0;
+
+    for (int i = 0; i < 16; i++)
+        inner.push_back(i);
+    bench::timer t;
+    Vector v;
+    for (unsigned long i = 0; i < count; i++) {
+        inner[0] = static_cast<int>(i);
+        v.push_back(inner);
+    }
+    bench::report("vector push_back", impl, t.elapsed(), count);
+    for (unsigned long i = 0; i < v.size(); i += 7)
+        sum += v[i][0] + v[i][15];
+    return (sum);
+}
+
+long map_strings(unsigned long count) {
+    typedef ft::map<int, std::string> map_type;
+    map_type m;
+    long sum = 0;
+    bench::timer t;
+
+    for (unsigned long i = 0; i < count; i++)
+        m.insert(map_type::value_type(static_cast<int>(i * 7919 % count), make_string(i)));
+    bench::report("map<int, string> insert", MODE, t.elapsed(), count);
+    for (map_type::iterator it = m.begin(); it != m.end(); ++it)
+        sum += it->second[0];
+    return (sum);
+}
+
+long stack_vectors(unsigned long count) {
+    ft::stack<ft::vector<int> > s;
+    long sum = 0;
+    bench::timer t;
+
+    for (unsigned long i = 0; i < count; i++) {
+        ft::vector<int> v(16, static_cast<int>(i));
+        s.push(FT_MOVE(v));
+    }
+    bench::report("stack<vector> push", MODE, t.elapsed(), count);
+    while (s.empty() == false) {
+        sum += s.top()[0];
+        s.pop();
+    }
+    return (sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long string_count = bench::arg_or(argc, argv, 1, 1000000);
+    const unsigned long vector_count = bench::arg_or(argc, argv, 2, 1000000);
+
+    std::cout << "mode: " << MODE << ", strings: " << string_count << ", vectors: " << vector_count << std::endl;
+    if (strings<ft::vector<std::string> >(MODE, string_count)
+        != strings<std::vector<std::string> >("std", string_count)) {
+        std::cerr << "Error: string results differ" << std::endl;
+        return (1);
+    }
+    if (nested<ft::vector<ft::vector<int> > >(MODE, vector_count)
+        != nested<std::vector<std::vector<int> > >("std", vector_count)) {
+        std::cerr << "Error: nested vector results differ" << std::endl;
+        return (1);
+    }
+    map_strings(string_count);
+    stack_vectors(vector_count);
+    return (0);
+}
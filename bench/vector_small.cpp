@@ -0,0 +1,105 @@
+#include <new>
+#include <vector>
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+#include "../vector/small_vector.hpp"
+#include "../stack/stack.hpp"
+
+// usage: ./bench/vector_small [containers]
+// Short-lived containers of 1 to 7 ints, built and dropped one after the
+// other like per-request scratch vectors, then the same past the inline
+// capacity. "small" is small_vector<int, 8>. Every operator new is counted,
+// so "allocs" is heap allocations per container.
+#if FT_HAS_MOVE
+# define BAD_ALLOC_SPEC
+#else
+# define BAD_ALLOC_SPEC throw(std::bad_alloc)
+#endif
+
+static unsigned long g_allocs = 0;
+
+void *operator new(std::size_t n) BAD_ALLOC_SPEC {
+    void *p = malloc(n > 0 ? n : 1);
+
+    if (p == 0)
+        throw std::bad_alloc();
+    g_allocs++;
+    return (p);
+}
+
+void operator delete(void *p) throw() {
+    free(p);
+}
+
+void report_allocs(const char *impl, unsigned long allocs, unsigned long count) {
+    std::cout << std::left << std::setw(28) << "  allocs / container" << std::setw(10) << impl
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << static_cast<double>(allocs) / count << std::endl;
+}
+
+template<class Vector>
+long fill(const char *name, const char *impl, unsigned long count, unsigned long max_len) {
+    unsigned long allocs = g_allocs;
+    long sum = 0;
+    bench::timer t;
+
+    for (unsigned long i = 0; i < count; i++) {
+        Vector v;
+        unsigned long len = 1 + i % max_len;
+
+        for (unsigned long j = 0; j < len; j++)
+            v.push_back(static_cast<int>(i + j));
+        sum += v[len / 2] + static_cast<long>(v.size());
+    }
+    bench::report(name, impl, t.elapsed(), count);
+    report_allocs(impl, g_allocs - allocs, count);
+    return (sum);
+}
+
+template<class Stack>
+long stack(const char *impl, unsigned long count) {
+    unsigned long allocs = g_allocs;
+    long sum = 0;
+    bench::timer t;
+
+    for (unsigned long i = 0; i < count; i++) {
+        Stack s;
+        unsigned long len = 1 + i % 7;
+
+        for (unsigned long j = 0; j < len; j++)
+            s.push(static_cast<int>(i + j));
+        while (s.empty() == false) {
+            sum += s.top();
+            s.pop();
+        }
+    }
+    bench::report("stack push/pop 1-7", impl, t.elapsed(), count);
+    report_allocs(impl, g_allocs - allocs, count);
+    return (sum);
+}
+
+template<class Vector>
+bool compare(const char *name, unsigned long count, unsigned long max_len) {
+    long ft_sum = fill<ft::vector<int> >(name, "ft", count, max_len);
+    long small_sum = fill<Vector>(name, "small", count, max_len);
+    long std_sum = fill<std::vector<int> >(name, "std", count, max_len);
+
+    return (ft_sum == std_sum && small_sum == std_sum);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long count = bench::arg_or(argc, argv, 1, 10000000);
+
+    std::cout << "containers: " << count << std::endl;
+    if (compare<ft::small_vector<int, 8> >("push_back 1-7", count, 7) == false
+        || compare<ft::small_vector<int, 8> >("push_back 1-32", count / 4, 32) == false) {
+        std::cerr << "Error: results differ" << std::endl;
+        return (1);
+    }
+    if (stack<ft::stack<int> >("ft", count)
+        != stack<ft::stack<int, ft::small_vector<int, 8> > >("small", count)) {
+        std::cerr << "Error: stack results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
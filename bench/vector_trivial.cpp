@@ -0,0 +1,127 @@
+#include <vector>
+#include <memory>
+#include "bench.hpp"
+#include "../vector/vector.hpp"
+
+// usage: ./bench/vector_trivial [ints] [buffers]
+// Growth by push_back, inserts and erases at the middle, and copies, for
+// ints and for main.cpp's 4 KB Buffer. "memmove" is ft::vector as is;
+// "loop" runs the same code through element-by-element copies. Middle
+// inserts and erases count every element they shift as one op.
+struct Buffer {
+    int idx;
+    char buff[4096];
+};
+
+// Behaves exactly like std::allocator, but ft::vector only takes its bulk
+// copy paths for the default allocator.
+template<class T>
+struct plain_allocator : public std::allocator<T> {
+    template<class U>
+    struct rebind {
+        typedef plain_allocator<U> other;
+    };
+
+    plain_allocator() {}
+
+    template<class U>
+    plain_allocator(const plain_allocator<U> &) {}
+};
+
+inline int key(int x) {
+    return (x);
+}
+
+inline int key(const Buffer &x) {
+    return (x.idx);
+}
+
+inline void set_key(int &x, int k) {
+    x = k;
+}
+
+inline void set_key(Buffer &x, int k) {
+    x.idx = k;
+}
+
+template<class Vector>
+long run(const char *type, const char *impl, unsigned long count) {
+    typedef typename Vector::value_type value_type;
+    std::string name(type);
+    unsigned long middle_size = count / 10;
+    unsigned long middle_ops = middle_size / 4 < 1000 ? middle_size / 4 : 1000;
+    unsigned long shifted = 0;
+    value_type val;
+    long sum = 0;
+
+    set_key(val, 0);
+    bench::timer t;
+    {
+        Vector v;
+
+        for (unsigned long i = 0; i < count; i++) {
+            set_key(val, static_cast<int>(i));
+            v.push_back(val);
+        }
+        bench::report((name + " push_back").c_str(), impl, t.elapsed(), count);
+        sum += key(v[count / 2]) + static_cast<long>(v.size());
+
+        t.reset();
+        {
+            Vector copy(v);
+
+            sum += key(copy.back());
+        }
+        bench::report((name + " copy").c_str(), impl, t.elapsed(), count);
+    }
+
+    Vector v;
+    for (unsigned long i = 0; i < middle_size; i++) {
+        set_key(val, static_cast<int>(i));
+        v.push_back(val);
+    }
+    t.reset();
+    for (unsigned long i = 0; i < middle_ops; i++) {
+        set_key(val, static_cast<int>(i));
+        shifted += v.size() - v.size() / 2;
+        v.insert(v.begin() + v.size() / 2, val);
+    }
+    bench::report((name + " insert middle").c_str(), impl, t.elapsed(), shifted);
+
+    shifted = 0;
+    t.reset();
+    for (unsigned long i = 0; i < middle_ops; i++) {
+        shifted += v.size() - v.size() / 3 - 1;
+        v.erase(v.begin() + v.size() / 3);
+    }
+    bench::report((name + " erase middle").c_str(), impl, t.elapsed(), shifted);
+
+    for (unsigned long i = 0; i < v.size(); i++)
+        sum += key(v[i]) * static_cast<long>(i % 7);
+    return (sum);
+}
+
+template<class T>
+int compare(const char *type, unsigned long count) {
+    long a = run<ft::vector<T, plain_allocator<T> > >(type, "loop", count);
+    long b = run<ft::vector<T> >(type, "memmove", count);
+    long c = run<std::vector<T> >(type, "std", count);
+
+    if (a != b || a != c) {
+        std::cerr << "Error: " << type << " results differ" << std::endl;
+        return (1);
+    }
+    return (0);
+}
+
+int main(int argc, char **argv) {
+    const unsigned long ints = bench::arg_or(argc, argv, 1, 10000000);
+    const unsigned long buffers = bench::arg_or(argc, argv, 2, 20000);
+
+    std::cout << "ints: " << ints << ", buffers: " << buffers << std::endl;
+    if (compare<int>("int", ints))
+        return (1);
+    if (compare<Buffer>("Buffer", buffers))
+        return (1);
+    return (0);
+}
@@ -0,0 +1,700 @@
+#ifndef BTREE
+#define BTREE
+
+#include <memory>
+#include "../util/util.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "btree_iterator.hpp"
+
+namespace ft {
+
+    template<class Value, class Compare, class Allocator = std::allocator<Value>, std::size_t NodeBytes = 256>
+    class btree {
+    public:
+        typedef Value value_type;
+        typedef Compare value_compare;
+
+        enum { slots = btree_slots<Value, NodeBytes>::value };
+        enum { min_count = (slots - 1) / 2 };
+        typedef btree_node<Value, slots> node_type;
+        typedef btree_internal<Value, slots> internal_type;
+        typedef node_type *node_pointer;
+
+        typedef typename Allocator::template rebind<node_type>::other leaf_allocator;
+        typedef typename Allocator::template rebind<internal_type>::other internal_allocator;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef typename allocator_type::size_type size_type;
+
+        typedef btree_iterator<value_type, node_type> iterator;
+        typedef btree_iterator<const value_type, node_type> const_iterator;
+
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        value_compare _comp;
+        allocator_type _allocator;
+        leaf_allocator _leaf_alloc;
+        internal_allocator _internal_alloc;
+        node_pointer _root;
+        node_pointer _leftmost;
+        node_pointer _rightmost;
+        size_type _size;
+
+    public:
+        btree() :
+                _comp(value_compare()), _leaf_alloc(this->_allocator), _internal_alloc(this->_allocator),
+                _root(0), _leftmost(0), _rightmost(0), _size(0) {}
+
+        btree(const value_compare &comp,
+              const allocator_type &alloc = allocator_type()) :
+                _comp(comp), _allocator(alloc), _leaf_alloc(alloc), _internal_alloc(alloc),
+                _root(0), _leftmost(0), _rightmost(0), _size(0) {}
+
+        template<class InputIterator>
+        btree(InputIterator first, InputIterator last,
+              const value_compare &comp,
+              const allocator_type &alloc = allocator_type()) :
+                _comp(comp), _allocator(alloc), _leaf_alloc(alloc), _internal_alloc(alloc),
+                _root(0), _leftmost(0), _rightmost(0), _size(0) {
+            insert(first, last);
+        }
+
+        btree(const btree &copy) :
+                _comp(copy._comp), _allocator(select_on_copy(copy._allocator)), _leaf_alloc(this->_allocator),
+                _internal_alloc(this->_allocator), _root(0), _leftmost(0), _rightmost(0), _size(0) {
+            *this = copy;
+        }
+
+        btree &operator=(const btree &copy) {
+            if (this == &copy)
+                return (*this);
+            clear();
+            this->_comp = copy._comp;
+            if (copy._root != 0) {
+                this->_root = clone_subtree(copy._root);
+                this->_leftmost = this->_root;
+                while (this->_leftmost->leaf == false)
+                    this->_leftmost = this->_leftmost->child(0);
+                this->_rightmost = this->_root;
+                while (this->_rightmost->leaf == false)
+                    this->_rightmost = this->_rightmost->child(this->_rightmost->count);
+            }
+            this->_size = copy._size;
+            return (*this);
+        }
+#if FT_HAS_MOVE
+
+        btree(btree &&x) :
+                _comp(x._comp), _allocator(x._allocator), _leaf_alloc(x._leaf_alloc), _internal_alloc(x._internal_alloc),
+                _root(0), _leftmost(0), _rightmost(0), _size(0) {
+            this->swap(x);
+        }
+
+        btree &operator=(btree &&x) {
+            if (this != &x) {
+                this->clear();
+                this->swap(x);
+            }
+            return (*this);
+        }
+#endif
+
+        ~btree() {
+            clear();
+        }
+
+        iterator begin() {
+            return (iterator(this->_leftmost, 0));
+        }
+
+        const_iterator begin() const {
+            return (const_iterator(this->_leftmost, 0));
+        }
+
+        iterator end() {
+            return (iterator(this->_rightmost, this->_rightmost == 0 ? 0 : this->_rightmost->count));
+        }
+
+        const_iterator end() const {
+            return (const_iterator(this->_rightmost, this->_rightmost == 0 ? 0 : this->_rightmost->count));
+        }
+
+        reverse_iterator rbegin() {
+            return (reverse_iterator(end()));
+        }
+
+        const_reverse_iterator rbegin() const {
+            return (const_reverse_iterator(end()));
+        }
+
+        reverse_iterator rend() {
+            return (reverse_iterator(begin()));
+        }
+
+        const_reverse_iterator rend() const {
+            return (const_reverse_iterator(begin()));
+        }
+
+        size_type size() const {
+            return (this->_size);
+        }
+
+        bool empty() const {
+            return (this->_size == 0);
+        }
+
+        size_type max_size() const {
+            return (this->_allocator.max_size());
+        }
+
+        value_compare value_comp() const {
+            return (this->_comp);
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
+        node_pointer new_node(bool leaf) {
+            node_pointer tmp_node;
+
+            if (leaf)
+                tmp_node = this->_leaf_alloc.allocate(1);
+            else
+                tmp_node = this->_internal_alloc.allocate(1);
+            tmp_node->parent = 0;
+            tmp_node->position = 0;
+            tmp_node->count = 0;
+            tmp_node->leaf = leaf;
+            return (tmp_node);
+        }
+
+        void delete_node(node_pointer cur_node) {
+            if (cur_node->leaf)
+                this->_leaf_alloc.deallocate(cur_node, 1);
+            else
+                this->_internal_alloc.deallocate(static_cast<internal_type *>(cur_node), 1);
+        }
+
+        void set_child(node_pointer p_node, int i, node_pointer c_node) {
+            p_node->child(i) = c_node;
+            c_node->parent = p_node;
+            c_node->position = static_cast<unsigned short>(i);
+        }
+
+        void move_value(node_pointer dst, int di, node_pointer src, int si) {
+            this->_allocator.construct(&dst->value(di), src->value(si));
+            this->_allocator.destroy(&src->value(si));
+        }
+
+        node_pointer clone_subtree(node_pointer src) {
+            node_pointer new_node_p = new_node(src->leaf);
+            int children = 0;
+
+            try {
+                for (int i = 0; i < src->count; i++) {
+                    this->_allocator.construct(&new_node_p->value(i), src->value(i));
+                    new_node_p->count++;
+                }
+                if (src->leaf == false) {
+                    for (; children <= src->count; children++)
+                        set_child(new_node_p, children, clone_subtree(src->child(children)));
+                }
+            } catch (...) {
+                for (int i = 0; i < children; i++)
+                    destroy_subtree(new_node_p->child(i));
+                for (int i = 0; i < new_node_p->count; i++)
+                    this->_allocator.destroy(&new_node_p->value(i));
+                delete_node(new_node_p);
+                throw;
+            }
+            return (new_node_p);
+        }
+
+        void destroy_subtree(node_pointer cur_node) {
+            for (int i = 0; i < cur_node->count; i++)
+                this->_allocator.destroy(&cur_node->value(i));
+            if (cur_node->leaf == false) {
+                for (int i = 0; i <= cur_node->count; i++)
+                    destroy_subtree(cur_node->child(i));
+            }
+            delete_node(cur_node);
+        }
+
+        void clear() {
+            if (this->_root != 0)
+                destroy_subtree(this->_root);
+            this->_root = 0;
+            this->_leftmost = 0;
+            this->_rightmost = 0;
+            this->_size = 0;
+        }
+
+        template<class Key>
+        int lower_in_node(node_pointer cur_node, const Key &k) const {
+            int first = 0;
+            int count = cur_node->count;
+
+            while (count > 0) {
+                int half = count / 2;
+
+                if (this->_comp(cur_node->value(first + half), k)) {
+                    first += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            return (first);
+        }
+
+        template<class Key>
+        int upper_in_node(node_pointer cur_node, const Key &k) const {
+            int first = 0;
+            int count = cur_node->count;
+
+            while (count > 0) {
+                int half = count / 2;
+
+                if (this->_comp(k, cur_node->value(first + half)) == false) {
+                    first += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            return (first);
+        }
+
+        // Returns the matching slot with true, or the leaf slot where k would
+        // be inserted with false.
+        template<class Key>
+        ft::pair<iterator, bool> find_leaf(const Key &k) const {
+            node_pointer cur_node = this->_root;
+
+            while (true) {
+                int i = lower_in_node(cur_node, k);
+
+                if (i < cur_node->count && this->_comp(k, cur_node->value(i)) == false)
+                    return (ft::pair<iterator, bool>(iterator(cur_node, i), true));
+                if (cur_node->leaf)
+                    return (ft::pair<iterator, bool>(iterator(cur_node, i), false));
+                cur_node = cur_node->child(i);
+            }
+        }
+
+        ft::pair<iterator, bool> insert(const value_type &val) {
+            if (this->_root == 0)
+                return (ft::pair<iterator, bool>(insert_root(val), true));
+            ft::pair<iterator, bool> pos = find_leaf(val);
+            if (pos.second)
+                return (ft::pair<iterator, bool>(pos.first, false));
+            return (ft::pair<iterator, bool>(insert_at(pos.first.base(), pos.first.position(), val), true));
+        }
+
+        template<class Key>
+        ft::pair<iterator, bool> try_emplace(const Key &k) {
+            if (this->_root == 0)
+                return (ft::pair<iterator, bool>(insert_root(value_type(k, typename value_type::second_type())), true));
+            ft::pair<iterator, bool> pos = find_leaf(k);
+            if (pos.second)
+                return (ft::pair<iterator, bool>(pos.first, false));
+            return (ft::pair<iterator, bool>(insert_at(pos.first.base(), pos.first.position(),
+                                                       value_type(k, typename value_type::second_type())), true));
+        }
+
+        template<class Key, class Mapped>
+        ft::pair<iterator, bool> try_emplace(const Key &k, const Mapped &obj) {
+            if (this->_root == 0)
+                return (ft::pair<iterator, bool>(insert_root(value_type(k, obj)), true));
+            ft::pair<iterator, bool> pos = find_leaf(k);
+            if (pos.second)
+                return (ft::pair<iterator, bool>(pos.first, false));
+            return (ft::pair<iterator, bool>(insert_at(pos.first.base(), pos.first.position(), value_type(k, obj)), true));
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            if (position == end() && this->_size != 0
+                && this->_comp(this->_rightmost->value(this->_rightmost->count - 1), val))
+                return (insert_at(this->_rightmost, this->_rightmost->count, val));
+            return (insert(val).first);
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first)
+                insert(end(), *first);
+        }
+
+        iterator insert_root(const value_type &val) {
+            this->_root = new_node(true);
+            this->_leftmost = this->_root;
+            this->_rightmost = this->_root;
+            return (insert_at(this->_root, 0, val));
+        }
+
+        iterator insert_at(node_pointer cur_node, int i, const value_type &val) {
+            if (cur_node->count == slots) {
+                node_pointer sibling = split_node(cur_node, i);
+
+                if (i > cur_node->count) {
+                    i -= cur_node->count + 1;
+                    cur_node = sibling;
+                }
+            }
+            for (int j = cur_node->count; j > i; j--)
+                move_value(cur_node, j, cur_node, j - 1);
+            try {
+                this->_allocator.construct(&cur_node->value(i), val);
+            } catch (...) {
+                iterator track;
+
+                for (int j = i; j < cur_node->count; j++)
+                    move_value(cur_node, j, cur_node, j + 1);
+                rebalance(cur_node, track);
+                throw;
+            }
+            cur_node->count++;
+            this->_size++;
+            return (iterator(cur_node, i));
+        }
+
+        // Splits a full node and moves its median into the parent, splitting
+        // the parent first if it is full too. Appending at either end of a node
+        // (sorted loads) leaves the old node full instead of halving it.
+        node_pointer split_node(node_pointer cur_node, int insert_pos) {
+            node_pointer p_node = cur_node->parent;
+
+            if (p_node == 0) {
+                p_node = new_node(false);
+                set_child(p_node, 0, cur_node);
+                this->_root = p_node;
+            } else if (p_node->count == slots) {
+                split_node(p_node, cur_node->position);
+                p_node = cur_node->parent;
+            }
+
+            int left_count = slots / 2;
+            if (insert_pos == slots)
+                left_count = slots - 1;
+            else if (insert_pos == 0)
+                left_count = 0;
+
+            node_pointer sibling = new_node(cur_node->leaf);
+            for (int j = left_count + 1; j < slots; j++)
+                move_value(sibling, j - left_count - 1, cur_node, j);
+            if (cur_node->leaf == false) {
+                for (int j = left_count + 1; j <= slots; j++)
+                    set_child(sibling, j - left_count - 1, cur_node->child(j));
+            }
+            sibling->count = static_cast<unsigned short>(slots - left_count - 1);
+
+            int p = cur_node->position;
+            for (int j = p_node->count; j > p; j--)
+                move_value(p_node, j, p_node, j - 1);
+            for (int j = p_node->count + 1; j > p + 1; j--)
+                set_child(p_node, j, p_node->child(j - 1));
+            move_value(p_node, p, cur_node, left_count);
+            set_child(p_node, p + 1, sibling);
+            p_node->count++;
+            cur_node->count = static_cast<unsigned short>(left_count);
+            if (cur_node == this->_rightmost)
+                this->_rightmost = sibling;
+            return (sibling);
+        }
+
+        // Returns the iterator following the erased value. The slot it names
+        // is tracked through every borrow and merge of the rebalance.
+        iterator erase(iterator position) {
+            node_pointer cur_node = position.base();
+            int i = position.position();
+            bool from_internal = (cur_node->leaf == false);
+            iterator track;
+
+            this->_allocator.destroy(&cur_node->value(i));
+            if (from_internal) {
+                node_pointer leaf = cur_node->child(i);
+                while (leaf->leaf == false)
+                    leaf = leaf->child(leaf->count);
+                move_value(cur_node, i, leaf, leaf->count - 1);
+                leaf->count--;
+                track = iterator(cur_node, i);
+                cur_node = leaf;
+            } else {
+                for (int j = i + 1; j < cur_node->count; j++)
+                    move_value(cur_node, j - 1, cur_node, j);
+                cur_node->count--;
+                track = iterator(cur_node, i);
+            }
+            this->_size--;
+            rebalance(cur_node, track);
+            if (this->_root == 0)
+                return (end());
+            if (from_internal)
+                return (++track);
+            return (track.settle());
+        }
+
+        template<class Key>
+        size_type erase(const Key &k) {
+            iterator it = find(k);
+
+            if (it == end())
+                return (0);
+            erase(it);
+            return (1);
+        }
+
+        void erase(iterator first, iterator last) {
+            if (first == begin() && last == end()) {
+                clear();
+                return;
+            }
+            size_type n = 0;
+            for (iterator it = first; it != last; ++it)
+                n++;
+            while (n-- > 0)
+                first = erase(first);
+        }
+
+        void rebalance(node_pointer cur_node, iterator &track) {
+            while (cur_node != this->_root && cur_node->count < min_count) {
+                node_pointer p_node = cur_node->parent;
+                int p = cur_node->position;
+                node_pointer l_node = (p > 0) ? p_node->child(p - 1) : 0;
+                node_pointer r_node = (p < p_node->count) ? p_node->child(p + 1) : 0;
+
+                if (l_node != 0 && l_node->count > min_count) {
+                    rotate_right(p_node, p - 1, track);
+                    return;
+                }
+                if (r_node != 0 && r_node->count > min_count) {
+                    rotate_left(p_node, p, track);
+                    return;
+                }
+                merge_nodes(p_node, (l_node != 0) ? p - 1 : p, track);
+                cur_node = p_node;
+            }
+            if (this->_root->count == 0) {
+                node_pointer old_root = this->_root;
+
+                if (old_root->leaf) {
+                    this->_root = 0;
+                    this->_leftmost = 0;
+                    this->_rightmost = 0;
+                } else {
+                    this->_root = old_root->child(0);
+                    this->_root->parent = 0;
+                    this->_root->position = 0;
+                }
+                delete_node(old_root);
+            }
+        }
+
+        void rotate_right(node_pointer p_node, int s, iterator &track) {
+            node_pointer l_node = p_node->child(s);
+            node_pointer r_node = p_node->child(s + 1);
+            int lc = l_node->count;
+
+            if (track.base() == r_node)
+                track = iterator(r_node, track.position() + 1);
+            else if ((track.base() == p_node && track.position() == s) || (track.base() == l_node && track.position() == lc))
+                track = iterator(r_node, 0);
+            else if (track.base() == l_node && track.position() == lc - 1)
+                track = iterator(p_node, s);
+
+            for (int j = r_node->count; j > 0; j--)
+                move_value(r_node, j, r_node, j - 1);
+            move_value(r_node, 0, p_node, s);
+            move_value(p_node, s, l_node, lc - 1);
+            if (r_node->leaf == false) {
+                for (int j = r_node->count + 1; j > 0; j--)
+                    set_child(r_node, j, r_node->child(j - 1));
+                set_child(r_node, 0, l_node->child(lc));
+            }
+            l_node->count--;
+            r_node->count++;
+        }
+
+        void rotate_left(node_pointer p_node, int s, iterator &track) {
+            node_pointer l_node = p_node->child(s);
+            node_pointer r_node = p_node->child(s + 1);
+            int lc = l_node->count;
+
+            if (track.base() == p_node && track.position() == s)
+                track = iterator(l_node, lc);
+            else if (track.base() == r_node && track.position() == 0)
+                track = iterator(p_node, s);
+            else if (track.base() == r_node)
+                track = iterator(r_node, track.position() - 1);
+
+            move_value(l_node, lc, p_node, s);
+            move_value(p_node, s, r_node, 0);
+            for (int j = 1; j < r_node->count; j++)
+                move_value(r_node, j - 1, r_node, j);
+            if (l_node->leaf == false) {
+                set_child(l_node, lc + 1, r_node->child(0));
+                for (int j = 1; j <= r_node->count; j++)
+                    set_child(r_node, j - 1, r_node->child(j));
+            }
+            l_node->count++;
+            r_node->count--;
+        }
+
+        void merge_nodes(node_pointer p_node, int s, iterator &track) {
+            node_pointer l_node = p_node->child(s);
+            node_pointer r_node = p_node->child(s + 1);
+            int lc = l_node->count;
+
+            if (track.base() == r_node)
+                track = iterator(l_node, lc + 1 + track.position());
+            else if (track.base() == p_node && track.position() == s)
+                track = iterator(l_node, lc);
+            else if (track.base() == p_node && track.position() > s)
+                track = iterator(p_node, track.position() - 1);
+
+            move_value(l_node, lc, p_node, s);
+            for (int j = 0; j < r_node->count; j++)
+                move_value(l_node, lc + 1 + j, r_node, j);
+            if (l_node->leaf == false) {
+                for (int j = 0; j <= r_node->count; j++)
+                    set_child(l_node, lc + 1 + j, r_node->child(j));
+            }
+            l_node->count = static_cast<unsigned short>(lc + 1 + r_node->count);
+
+            for (int j = s + 1; j < p_node->count; j++)
+                move_value(p_node, j - 1, p_node, j);
+            for (int j = s + 2; j <= p_node->count; j++)
+                set_child(p_node, j - 1, p_node->child(j));
+            p_node->count--;
+            if (r_node == this->_rightmost)
+                this->_rightmost = l_node;
+            delete_node(r_node);
+        }
+
+        void swap(btree &x) {
+            std::swap(this->_comp, x._comp);
+            std::swap(this->_allocator, x._allocator);
+            std::swap(this->_leaf_alloc, x._leaf_alloc);
+            std::swap(this->_internal_alloc, x._internal_alloc);
+            std::swap(this->_root, x._root);
+            std::swap(this->_leftmost, x._leftmost);
+            std::swap(this->_rightmost, x._rightmost);
+            std::swap(this->_size, x._size);
+        }
+
+        template<class Key>
+        iterator search(const Key &k) const {
+            node_pointer cur_node = this->_root;
+
+            while (cur_node != 0) {
+                int i = lower_in_node(cur_node, k);
+
+                if (i < cur_node->count && this->_comp(k, cur_node->value(i)) == false)
+                    return (iterator(cur_node, i));
+                if (cur_node->leaf)
+                    break;
+                cur_node = cur_node->child(i);
+            }
+            return (iterator(this->_rightmost, this->_rightmost == 0 ? 0 : this->_rightmost->count));
+        }
+
+        template<class Key>
+        iterator find(const Key &k) {
+            return (search(k));
+        }
+
+        template<class Key>
+        const_iterator find(const Key &k) const {
+            return (search(k));
+        }
+
+        template<class Key>
+        size_type count(const Key &k) const {
+            return (find(k) != end());
+        }
+
+        template<class Key>
+        iterator lower_bound_slot(const Key &k) const {
+            node_pointer cur_node = this->_root;
+            iterator res(this->_rightmost, this->_rightmost == 0 ? 0 : this->_rightmost->count);
+
+            while (cur_node != 0) {
+                int i = lower_in_node(cur_node, k);
+
+                if (i < cur_node->count)
+                    res = iterator(cur_node, i);
+                if (cur_node->leaf)
+                    break;
+                cur_node = cur_node->child(i);
+            }
+            return (res);
+        }
+
+        template<class Key>
+        iterator upper_bound_slot(const Key &k) const {
+            node_pointer cur_node = this->_root;
+            iterator res(this->_rightmost, this->_rightmost == 0 ? 0 : this->_rightmost->count);
+
+            while (cur_node != 0) {
+                int i = upper_in_node(cur_node, k);
+
+                if (i < cur_node->count)
+                    res = iterator(cur_node, i);
+                if (cur_node->leaf)
+                    break;
+                cur_node = cur_node->child(i);
+            }
+            return (res);
+        }
+
+        template<class Key>
+        iterator lower_bound(const Key &k) {
+            return (lower_bound_slot(k));
+        }
+
+        template<class Key>
+        const_iterator lower_bound(const Key &k) const {
+            return (lower_bound_slot(k));
+        }
+
+        template<class Key>
+        iterator upper_bound(const Key &k) {
+            return (upper_bound_slot(k));
+        }
+
+        template<class Key>
+        const_iterator upper_bound(const Key &k) const {
+            return (upper_bound_slot(k));
+        }
+
+        template<class Key>
+        pair<iterator, iterator> equal_range(const Key &k) {
+            return (ft::make_pair(lower_bound(k), upper_bound(k)));
+        }
+
+        template<class Key>
+        pair<const_iterator, const_iterator> equal_range(const Key &k) const {
+            return (ft::make_pair(lower_bound(k), upper_bound(k)));
+        }
+    };
+
+    template<class Content, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<(const btree<Content, Compare, Alloc, NodeBytes> &lhs, const btree<Content, Compare, Alloc, NodeBytes> &rhs) {
+        return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+
+    template<class Content, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator==(const btree<Content, Compare, Alloc, NodeBytes> &lhs, const btree<Content, Compare, Alloc, NodeBytes> &rhs) {
+        return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+}
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef BTREE_ITERATOR
+#define BTREE_ITERATOR
+
+#include <cstddef>
+#include "../iterator/iterator_traits.hpp"
+
+namespace ft {
+    template<class Value, std::size_t Slots>
+    struct btree_internal;
+
+    // Fits as many values as NodeBytes allows next to the 16-byte header,
+    // never fewer than three so splits and merges stay well defined.
+    template<class Value, std::size_t NodeBytes>
+    struct btree_slots {
+        enum { fit = (NodeBytes - 2 * sizeof(void *)) / sizeof(Value) };
+        enum { value = fit < 3 ? 3 : (fit > 255 ? 255 : fit) };
+    };
+
+    // Values live in raw storage and are constructed in place, so a node of
+    // Slots values never default-constructs a Value. Internal nodes append the
+    // child array; leaves are allocated without it.
+    template<class Value, std::size_t Slots>
+    struct btree_node {
+        typedef Value value_type;
+
+        btree_node *parent;
+        unsigned short position;
+        unsigned short count;
+        bool leaf;
+        union {
+            char raw[Slots * sizeof(Value)];
+            long double align_ld;
+            long long align_ll;
+            void *align_p;
+        } storage;
+
+        Value *values() {
+            return (reinterpret_cast<Value *>(this->storage.raw));
+        }
+
+        Value &value(std::size_t i) {
+            return (values()[i]);
+        }
+
+        btree_node *&child(std::size_t i) {
+            return (static_cast<btree_internal<Value, Slots> *>(this)->children[i]);
+        }
+    };
+
+    template<class Value, std::size_t Slots>
+    struct btree_internal : public btree_node<Value, Slots> {
+        btree_node<Value, Slots> *children[Slots + 1];
+    };
+
+    // end() is one past the last value of the rightmost leaf, which keeps
+    // --end() a plain decrement.
+    template<class T, class NodeType>
+    class btree_iterator {
+    public:
+        typedef T iterator_type;
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename iterator_traits<iterator_type *>::value_type value_type;
+        typedef typename iterator_traits<iterator_type *>::pointer pointer;
+        typedef typename iterator_traits<iterator_type *>::reference reference;
+        typedef typename iterator_traits<iterator_type *>::difference_type difference_type;
+        typedef NodeType *node_pointer;
+
+    private:
+        node_pointer _node_p;
+        int _position;
+
+    public:
+        btree_iterator() : _node_p(0), _position(0) {}
+
+        btree_iterator(node_pointer node_p, int position) : _node_p(node_p), _position(position) {}
+
+        btree_iterator(const btree_iterator<typename NodeType::value_type, NodeType> &other) {
+            *this = other;
+        }
+
+        btree_iterator &operator=(const btree_iterator<typename NodeType::value_type, NodeType> &copy) {
+            this->_node_p = copy.base();
+            this->_position = copy.position();
+            return (*this);
+        }
+
+        ~btree_iterator() {}
+
+        node_pointer base() const {
+            return (this->_node_p);
+        }
+
+        int position() const {
+            return (this->_position);
+        }
+
+        reference operator*() const {
+            return (this->_node_p->value(this->_position));
+        }
+
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        btree_iterator &operator++() {
+            if (this->_node_p->leaf == false) {
+                this->_node_p = this->_node_p->child(this->_position + 1);
+                while (this->_node_p->leaf == false)
+                    this->_node_p = this->_node_p->child(0);
+                this->_position = 0;
+                return (*this);
+            }
+            this->_position++;
+            return (settle());
+        }
+
+        btree_iterator operator++(int) {
+            btree_iterator tmp(*this);
+
+            ++(*this);
+            return (tmp);
+        }
+
+        btree_iterator &operator--() {
+            if (this->_node_p->leaf == false) {
+                this->_node_p = this->_node_p->child(this->_position);
+                while (this->_node_p->leaf == false)
+                    this->_node_p = this->_node_p->child(this->_node_p->count);
+                this->_position = this->_node_p->count - 1;
+                return (*this);
+            }
+            if (this->_position > 0) {
+                this->_position--;
+                return (*this);
+            }
+            node_pointer cur_node = this->_node_p;
+            while (cur_node->parent != 0 && cur_node->position == 0)
+                cur_node = cur_node->parent;
+            if (cur_node->parent != 0) {
+                this->_position = cur_node->position - 1;
+                this->_node_p = cur_node->parent;
+            }
+            return (*this);
+        }
+
+        btree_iterator operator--(int) {
+            btree_iterator tmp(*this);
+
+            --(*this);
+            return (tmp);
+        }
+
+        // A leaf position equal to its count means "whatever follows this
+        // leaf": climb to the separator after it, or stay put as end().
+        btree_iterator &settle() {
+            if (this->_node_p == 0 || this->_node_p->leaf == false || this->_position < this->_node_p->count)
+                return (*this);
+            node_pointer cur_node = this->_node_p;
+            while (cur_node->parent != 0 && cur_node->position == cur_node->parent->count)
+                cur_node = cur_node->parent;
+            if (cur_node->parent != 0) {
+                this->_position = cur_node->position;
+                this->_node_p = cur_node->parent;
+            }
+            return (*this);
+        }
+    };
+
+    template<typename A, typename B, typename NodeType>
+    bool operator==(const btree_iterator<A, NodeType> &lhs,
+                    const btree_iterator<B, NodeType> &rhs) {
+        return (lhs.base() == rhs.base() && lhs.position() == rhs.position());
+    }
+
+    template<typename A, typename B, typename NodeType>
+    bool operator!=(const btree_iterator<A, NodeType> &lhs,
+                    const btree_iterator<B, NodeType> &rhs) {
+        return (!(lhs == rhs));
+    }
+}
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef BTREE_MAP
+#define BTREE_MAP
+
+#include "../util/util.hpp"
+#include "../map/pair_compare.hpp"
+#include "btree.hpp"
+
+namespace ft {
+    // Same interface as ft::map on a B-tree of NodeBytes-sized nodes, so a
+    // lookup touches one node per level instead of one value. Unlike ft::map,
+    // insert and erase may move values between nodes: they invalidate every
+    // iterator, as in any B-tree. Nodes keep no aggregates, so there is no
+    // NodeUpdate policy and nothing to refresh when a value is assigned.
+    template<class Key, class value, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, value> >,
+            std::size_t NodeBytes = 256>
+    class btree_map {
+    public:
+        typedef Key key_type;
+        typedef value mapped_type;
+
+        typedef pair<const Key, value> value_type;
+        typedef Compare key_compare;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef std::ptrdiff_t difference_type;
+        typedef std::size_t size_type;
+        typedef ft::pair_compare<value_type, Compare> value_compare;
+        typedef btree<value_type, value_compare, allocator_type, NodeBytes> tree_type;
+        typedef typename tree_type::iterator iterator;
+        typedef typename tree_type::const_iterator const_iterator;
+        typedef typename tree_type::reverse_iterator reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+    private:
+        key_compare _comp;
+        tree_type _tree;
+        
+    public:
+        explicit btree_map(const key_compare &comp = key_compare(),
+                           const allocator_type &alloc = allocator_type()) : _comp(comp), _tree(comp, alloc) {}
+
+        template<class InputIterator>
+        btree_map(InputIterator first, InputIterator last,
+                  const key_compare &comp = key_compare(),
+                  const allocator_type &alloc = allocator_type())
+                :_comp(comp), _tree(first, last, comp, alloc) {}
+
+        btree_map(const btree_map &x) : _comp(x._comp), _tree(x._tree) {}
+
+        btree_map &operator=(const btree_map &x) {
+            if (this != &x) {
+                this->_comp = x._comp;
+                this->_tree = x._tree;
+            }
+            return (*this);
+        }
+#if FT_HAS_MOVE
+
+        btree_map(btree_map &&x) : _comp(x._comp), _tree(std::move(x._tree)) {}
+
+        btree_map &operator=(btree_map &&x) {
+            if (this != &x) {
+                this->_comp = x._comp;
+                this->_tree = std::move(x._tree);
+            }
+            return (*this);
+        }
+#endif
+
+        ~btree_map() {}
+
+        iterator begin() {
+            return (this->_tree.begin());
+        }
+
+        const_iterator begin() const {
+            return (this->_tree.begin());
+        }
+
+        iterator end() {
+            return (this->_tree.end());
+        }
+
+        const_iterator end() const {
+            return (this->_tree.end());
+        }
+
+        reverse_iterator rbegin() {
+            return (this->_tree.rbegin());
+        }
+
+        const_reverse_iterator rbegin() const {
+            return (this->_tree.rbegin());
+        }
+
+        reverse_iterator rend() {
+            return (this->_tree.rend());
+        }
+
+        const_reverse_iterator rend() const {
+            return (this->_tree.rend());
+        }
+
+        bool empty() const {
+            return (this->_tree.empty());
+        }
+
+        size_type size() const {
+            return (this->_tree.size());
+        }
+
+        size_type max_size() const {
+            return (this->_tree.max_size());
+        }
+
+        mapped_type &operator[](const key_type &k) {
+            return (this->_tree.try_emplace(k).first->second);
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k) {
+            return (this->_tree.try_emplace(k));
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k, const mapped_type &obj) {
+            return (this->_tree.try_emplace(k, obj));
+        }
+
+        pair<iterator, bool> insert_or_assign(const key_type &k, const mapped_type &obj) {
+            pair<iterator, bool> res = this->_tree.try_emplace(k, obj);
+
+            if (res.second == false)
+                res.first->second = obj;
+            return (res);
+        }
+
+        pair<iterator, bool> insert(const value_type &val) {
+            return (this->_tree.insert(val));
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            return (this->_tree.insert(position, val));
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            return (this->_tree.insert(first, last));
+        }
+
+        void erase(iterator position) {
+            this->_tree.erase(position);
+        }
+
+        size_type erase(const key_type &k) {
+
+            return (this->_tree.erase(k));
+        }
+
+        void erase(iterator first, iterator last) {
+            this->_tree.erase(first, last);
+        }
+
+        void swap(btree_map &x) {
+            this->_tree.swap(x._tree);
+        }
+
+        void clear() {
+            this->_tree.clear();
+        }
+
+        key_compare key_comp() const {
+            return (this->_comp);
+        }
+
+        value_compare value_comp() const {
+            return (this->_tree.value_comp());
+        }
+
+        iterator find(const key_type &k) {
+            return (this->_tree.find(k));
+        }
+
+        const_iterator find(const key_type &k) const {
+            return (this->_tree.find(k));
+        }
+
+        size_type count(const key_type &k) const {
+            return (this->_tree.count(k));
+        }
+
+        iterator lower_bound(const key_type &k) {
+            return (this->_tree.lower_bound(k));
+        }
+
+        const_iterator lower_bound(const key_type &k) const {
+            return (this->_tree.lower_bound(k));
+        }
+
+        iterator upper_bound(const key_type &k) {
+            return (this->_tree.upper_bound(k));
+        }
+
+        const_iterator upper_bound(const key_type &k) const {
+            return (this->_tree.upper_bound(k));
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &k) {
+            return (this->_tree.equal_range(k));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const {
+            return (this->_tree.equal_range(k));
+        }
+
+        FT_TRANSPARENT_LOOKUP(this->_tree)
+
+        allocator_type get_allocator() const {
+            return (this->_tree.get_allocator());
+        }
+
+        template<class _Key, class _T, class _Compare, class _Alloc, std::size_t _NodeBytes>
+        friend bool operator==(const btree_map<_Key, _T, _Compare, _Alloc, _NodeBytes> &lhs,
+                               const btree_map<_Key, _T, _Compare, _Alloc, _NodeBytes> &rhs);
+
+        template<class _Key, class _T, class _Compare, class _Alloc, std::size_t _NodeBytes>
+        friend bool operator<(const btree_map<_Key, _T, _Compare, _Alloc, _NodeBytes> &lhs,
+                              const btree_map<_Key, _T, _Compare, _Alloc, _NodeBytes> &rhs);
+
+    };
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator==(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        return (lhs._tree == rhs._tree);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator!=(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        return (lhs._tree < rhs._tree);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator>(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        return (rhs < lhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator<=(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        return !(lhs > rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    bool operator>=(const btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, const btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        return !(lhs < rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc, std::size_t NodeBytes>
+    void swap(btree_map<Key, T, Compare, Alloc, NodeBytes> &lhs, btree_map<Key, T, Compare, Alloc, NodeBytes> &rhs) {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+#ifndef CONCURRENT_MAP
+#define CONCURRENT_MAP
+
+#include <functional>
+#include "../util/util.hpp"
+#include "../map/pair_compare.hpp"
+#include "skiplist.hpp"
+
+namespace ft {
+    // An ordered map that any number of threads may read and write at once.
+    // find, insert, insert_or_assign, erase, count and iteration are safe to
+    // mix freely; construction and destruction are not. Since another thread
+    // may erase an entry at any moment, lookups copy the mapped value out
+    // instead of handing back references, and iterators are read-only and
+    // weakly consistent.
+    template<class Key, class value, class Compare = std::less<Key>,
+            class Allocator = std::allocator<pair<const Key, value> > >
+    class concurrent_map {
+    public:
+        typedef Key key_type;
+        typedef value mapped_type;
+
+        typedef pair<const Key, value> value_type;
+        typedef Compare key_compare;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef std::ptrdiff_t difference_type;
+        typedef std::size_t size_type;
+        typedef ft::pair_compare<value_type, Compare> value_compare;
+        typedef skiplist<value_type, value_compare, allocator_type> list_type;
+        typedef typename list_type::iterator iterator;
+        typedef typename list_type::const_iterator const_iterator;
+
+    private:
+        key_compare _comp;
+        allocator_type _allocator;
+        list_type _list;
+
+        concurrent_map(const concurrent_map &);
+
+        concurrent_map &operator=(const concurrent_map &);
+
+    public:
+        explicit concurrent_map(const key_compare &comp = key_compare(),
+                                const allocator_type &alloc = allocator_type())
+                : _comp(comp), _allocator(alloc), _list(comp, alloc) {}
+
+        template<class InputIterator>
+        concurrent_map(InputIterator first, InputIterator last,
+                       const key_compare &comp = key_compare(),
+                       const allocator_type &alloc = allocator_type())
+                : _comp(comp), _allocator(alloc), _list(comp, alloc) {
+            insert(first, last);
+        }
+
+        ~concurrent_map() {}
+
+        const_iterator begin() const {
+            return (this->_list.begin());
+        }
+
+        const_iterator end() const {
+            return (this->_list.end());
+        }
+
+        bool empty() const {
+            return (this->_list.size() == 0);
+        }
+
+        size_type size() const {
+            return (this->_list.size());
+        }
+
+        size_type max_size() const {
+            return (this->_list.max_size());
+        }
+
+        bool insert(const value_type &val) {
+            return (this->_list.insert(val));
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first)
+                this->_list.insert(*first);
+        }
+
+        bool insert_or_assign(const key_type &k, const mapped_type &obj) {
+            return (this->_list.insert_or_assign(value_type(k, obj)));
+        }
+
+        size_type erase(const key_type &k) {
+            return (this->_list.erase(k));
+        }
+
+        bool find(const key_type &k, mapped_type &out) const {
+            return (this->_list.find(k, out));
+        }
+
+        size_type count(const key_type &k) const {
+            return (this->_list.contains(k) ? 1 : 0);
+        }
+
+        const_iterator lower_bound(const key_type &k) const {
+            return (this->_list.lower_bound(k));
+        }
+
+        key_compare key_comp() const {
+            return (this->_comp);
+        }
+
+        value_compare value_comp() const {
+            return (this->_list.value_comp());
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+    };
+}
+
+#endif
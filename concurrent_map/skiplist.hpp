@@ -0,0 +1,443 @@
+#ifndef SKIPLIST
+#define SKIPLIST
+
+#include <memory>
+#include <new>
+#include "../util/util.hpp"
+#include "sync.hpp"
+#include "skiplist_iterator.hpp"
+
+namespace ft {
+    // The lazy skiplist of Herlihy, Lev, Luchangco and Shavit. Lookups never
+    // lock. Insert locks the predecessors it links into and erase locks the
+    // victim and then its predecessors, always in decreasing key order, and
+    // both validate what they saw before changing anything.
+    //
+    // Erased nodes are retired rather than freed, since lookups may still be
+    // walking through them, and are released a couple of epochs later.
+    template<class Value, class Compare, class Allocator = std::allocator<Value> >
+    class skiplist {
+    public:
+        typedef Value value_type;
+        typedef Compare value_compare;
+
+        enum { max_level = 32 };
+        enum { retire_batch = 64 };
+
+        typedef skiplist_node<Value> node_type;
+        typedef node_type *node_pointer;
+
+        // Nodes vary in size with their level, so they are allocated in
+        // units aligned like the node itself.
+        union word_type {
+            void *p;
+            long double ld;
+            long long ll;
+        };
+        typedef typename Allocator::template rebind<word_type>::other word_allocator;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef typename allocator_type::size_type size_type;
+
+        typedef skiplist_iterator<value_type> iterator;
+        typedef skiplist_iterator<value_type> const_iterator;
+
+    private:
+        value_compare _comp;
+        allocator_type _allocator;
+        word_allocator _word_alloc;
+        node_pointer _head;
+        size_type _size;
+        unsigned long _seed;
+        mutable epoch_domain _epochs;
+        spinlock _retire_lock;
+        node_pointer _retired[2];
+        size_type _retired_count[2];
+
+        skiplist(const skiplist &);
+
+        skiplist &operator=(const skiplist &);
+
+    public:
+        explicit skiplist(const value_compare &comp, const allocator_type &alloc = allocator_type()) :
+                _comp(comp), _allocator(alloc), _word_alloc(alloc), _head(0), _size(0), _seed(0x2545f491UL) {
+            this->_retired[0] = 0;
+            this->_retired[1] = 0;
+            this->_retired_count[0] = 0;
+            this->_retired_count[1] = 0;
+            this->_head = allocate_node(max_level);
+        }
+
+        // Not concurrent with anything.
+        ~skiplist() {
+            node_pointer cur_node = this->_head->next[0];
+
+            while (cur_node != 0) {
+                node_pointer next = cur_node->next[0];
+                destroy_node(cur_node);
+                cur_node = next;
+            }
+            free_retired(0);
+            free_retired(1);
+            deallocate_node(this->_head);
+        }
+
+        const_iterator begin() const {
+            epoch_guard guard(&this->_epochs);
+
+            return (const_iterator(guard, atomic_load(&this->_head->next[0])));
+        }
+
+        const_iterator end() const {
+            return (const_iterator());
+        }
+
+        template<class Key>
+        const_iterator lower_bound(const Key &k) const {
+            epoch_guard guard(&this->_epochs);
+            node_pointer pred = this->_head;
+            node_pointer cur_node = 0;
+
+            for (int level = max_level - 1; level >= 0; level--) {
+                cur_node = atomic_load(&pred->next[level]);
+                while (cur_node != 0 && this->_comp(cur_node->value(), k)) {
+                    pred = cur_node;
+                    cur_node = atomic_load(&pred->next[level]);
+                }
+            }
+            return (const_iterator(guard, cur_node));
+        }
+
+        // Exact between quiescent points, approximate while writers run.
+        size_type size() const {
+            return (atomic_load(&this->_size));
+        }
+
+        size_type max_size() const {
+            return (this->_allocator.max_size());
+        }
+
+        value_compare value_comp() const {
+            return (this->_comp);
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
+        template<class Key>
+        bool contains(const Key &k) const {
+            epoch_guard guard(&this->_epochs);
+            node_pointer found = search(k);
+
+            return (found != 0 && found->live());
+        }
+
+        // Copies the mapped value out under the node's lock.
+        template<class Key, class Mapped>
+        bool find(const Key &k, Mapped &out) const {
+            epoch_guard guard(&this->_epochs);
+            node_pointer found = search(k);
+
+            if (found == 0 || atomic_load(&found->fully_linked) == 0)
+                return (false);
+            found->lock.lock();
+            bool live = found->marked == 0;
+            if (live)
+                out = found->value().second;
+            found->lock.unlock();
+            return (live);
+        }
+
+        bool insert(const value_type &val) {
+            return (insert_or_update(val, false));
+        }
+
+        // Returns true if the key was new and inserted, false if an existing
+        // value was overwritten.
+        bool insert_or_assign(const value_type &val) {
+            return (insert_or_update(val, true));
+        }
+
+        template<class Key>
+        size_type erase(const Key &k) {
+            bool removed;
+            {
+                epoch_guard guard(&this->_epochs);
+
+                removed = remove(k);
+            }
+            if (removed)
+                reclaim();
+            return (removed ? 1 : 0);
+        }
+
+    private:
+        size_type node_words(int levels) const {
+            return ((sizeof(node_type) + (levels - 1) * sizeof(node_pointer) + sizeof(word_type) - 1)
+                    / sizeof(word_type));
+        }
+
+        node_pointer allocate_node(int levels) {
+            word_type *words = this->_word_alloc.allocate(node_words(levels));
+
+            return (::new(static_cast<void *>(words)) node_type(levels));
+        }
+
+        void deallocate_node(node_pointer node) {
+            int levels = node->top_level;
+
+            node->~node_type();
+            this->_word_alloc.deallocate(reinterpret_cast<word_type *>(node), node_words(levels));
+        }
+
+        node_pointer create_node(const value_type &val, int levels) {
+            node_pointer new_node = allocate_node(levels);
+
+            try {
+                this->_allocator.construct(&new_node->value(), val);
+            }
+            catch (...) {
+                deallocate_node(new_node);
+                throw;
+            }
+            return (new_node);
+        }
+
+        void destroy_node(node_pointer node) {
+            this->_allocator.destroy(&node->value());
+            deallocate_node(node);
+        }
+
+        // Geometric with p = 1/4, from a shared counter run through a mixer
+        // so threads need no generator state of their own.
+        int random_level() {
+            unsigned long x = atomic_fetch_add(&this->_seed, 0x9e3779b9UL);
+            int levels = 1;
+
+            x ^= x >> 16;
+            x *= 0x85ebca6bUL;
+            x ^= x >> 13;
+            x *= 0xc2b2ae35UL;
+            x ^= x >> 16;
+            while ((x & 3) == 3 && levels < max_level) {
+                levels++;
+                x >>= 2;
+            }
+            return (levels);
+        }
+
+        template<class Key>
+        node_pointer search(const Key &k) const {
+            node_pointer pred = this->_head;
+
+            for (int level = max_level - 1; level >= 0; level--) {
+                node_pointer cur_node = atomic_load(&pred->next[level]);
+
+                while (cur_node != 0 && this->_comp(cur_node->value(), k)) {
+                    pred = cur_node;
+                    cur_node = atomic_load(&pred->next[level]);
+                }
+                if (cur_node != 0 && this->_comp(k, cur_node->value()) == false)
+                    return (cur_node);
+            }
+            return (0);
+        }
+
+        // Fills preds and succs on every level; returns the highest level
+        // holding k, or -1.
+        template<class Key>
+        int find_window(const Key &k, node_pointer *preds, node_pointer *succs) const {
+            int found = -1;
+            node_pointer pred = this->_head;
+
+            for (int level = max_level - 1; level >= 0; level--) {
+                node_pointer cur_node = atomic_load(&pred->next[level]);
+
+                while (cur_node != 0 && this->_comp(cur_node->value(), k)) {
+                    pred = cur_node;
+                    cur_node = atomic_load(&pred->next[level]);
+                }
+                if (found == -1 && cur_node != 0 && this->_comp(k, cur_node->value()) == false)
+                    found = level;
+                preds[level] = pred;
+                succs[level] = cur_node;
+            }
+            return (found);
+        }
+
+        static void unlock_preds(node_pointer *preds, int highest) {
+            node_pointer prev = 0;
+
+            for (int level = 0; level <= highest; level++) {
+                if (preds[level] != prev) {
+                    preds[level]->lock.unlock();
+                    prev = preds[level];
+                }
+            }
+        }
+
+        // Locks the distinct predecessors bottom-up and checks that each
+        // still links to an unerased succs[level] and is not being erased.
+        bool lock_preds(node_pointer *preds, node_pointer *succs, int levels, int &highest) const {
+            node_pointer prev = 0;
+
+            highest = -1;
+            for (int level = 0; level < levels; level++) {
+                node_pointer pred = preds[level];
+                node_pointer succ = succs[level];
+
+                if (pred != prev) {
+                    pred->lock.lock();
+                    highest = level;
+                    prev = pred;
+                }
+                if (pred->marked != 0 || (succ != 0 && atomic_load(&succ->marked) != 0)
+                    || atomic_load(&pred->next[level]) != succ)
+                    return (false);
+            }
+            return (true);
+        }
+
+        bool insert_or_update(const value_type &val, bool assign) {
+            node_pointer preds[max_level];
+            node_pointer succs[max_level];
+            node_pointer new_node = 0;
+            epoch_guard guard(&this->_epochs);
+
+            for (;;) {
+                int found = find_window(val, preds, succs);
+
+                if (found != -1) {
+                    node_pointer existing = succs[found];
+
+                    if (atomic_load(&existing->marked) == 0) {
+                        while (atomic_load(&existing->fully_linked) == 0)
+                            sched_yield();
+                        if (assign) {
+                            existing->lock.lock();
+                            bool live = existing->marked == 0;
+                            if (live)
+                                existing->value().second = val.second;
+                            existing->lock.unlock();
+                            if (live == false)
+                                continue;
+                        }
+                        if (new_node != 0)
+                            destroy_node(new_node);
+                        return (false);
+                    }
+                    continue;
+                }
+                if (new_node == 0)
+                    new_node = create_node(val, random_level());
+                int levels = new_node->top_level;
+                int highest;
+                if (lock_preds(preds, succs, levels, highest) == false) {
+                    unlock_preds(preds, highest);
+                    continue;
+                }
+                for (int level = 0; level < levels; level++)
+                    new_node->next[level] = succs[level];
+                for (int level = 0; level < levels; level++)
+                    atomic_store(&preds[level]->next[level], new_node);
+                atomic_store(&new_node->fully_linked, 1);
+                unlock_preds(preds, highest);
+                atomic_fetch_add(&this->_size, static_cast<size_type>(1));
+                return (true);
+            }
+        }
+
+        template<class Key>
+        bool remove(const Key &k) {
+            node_pointer preds[max_level];
+            node_pointer succs[max_level];
+            node_pointer victim = 0;
+            bool is_marked = false;
+
+            for (;;) {
+                int found = find_window(k, preds, succs);
+
+                if (is_marked == false) {
+                    if (found == -1)
+                        return (false);
+                    victim = succs[found];
+                    if (atomic_load(&victim->fully_linked) == 0 || victim->top_level - 1 != found
+                        || atomic_load(&victim->marked) != 0)
+                        return (false);
+                    victim->lock.lock();
+                    if (victim->marked != 0) {
+                        victim->lock.unlock();
+                        return (false);
+                    }
+                    atomic_store(&victim->marked, 1);
+                    is_marked = true;
+                }
+                int levels = victim->top_level;
+                int highest = -1;
+                bool valid = true;
+                node_pointer prev = 0;
+                for (int level = 0; valid && level < levels; level++) {
+                    node_pointer pred = preds[level];
+
+                    if (pred != prev) {
+                        pred->lock.lock();
+                        highest = level;
+                        prev = pred;
+                    }
+                    valid = pred->marked == 0 && atomic_load(&pred->next[level]) == victim;
+                }
+                if (valid == false) {
+                    unlock_preds(preds, highest);
+                    continue;
+                }
+                for (int level = levels - 1; level >= 0; level--)
+                    atomic_store(&preds[level]->next[level], victim->next[level]);
+                victim->lock.unlock();
+                unlock_preds(preds, highest);
+                atomic_fetch_sub(&this->_size, static_cast<size_type>(1));
+                retire(victim);
+                return (true);
+            }
+        }
+
+        void retire(node_pointer node) {
+            this->_retire_lock.lock();
+            unsigned long e = this->_epochs.epoch();
+            node->retired = this->_retired[e & 1];
+            this->_retired[e & 1] = node;
+            this->_retired_count[e & 1]++;
+            this->_retire_lock.unlock();
+        }
+
+        // Called outside any pin, so the caller's own operation never holds
+        // the epoch back.
+        void reclaim() {
+            unsigned long from;
+
+            this->_retire_lock.lock();
+            if (this->_retired_count[this->_epochs.epoch() & 1] >= retire_batch && this->_epochs.try_advance(from))
+                free_retired((from + 1) & 1);
+            this->_retire_lock.unlock();
+        }
+
+        void free_retired(int parity) {
+            node_pointer cur_node = this->_retired[parity];
+
+            while (cur_node != 0) {
+                node_pointer next = cur_node->retired;
+                destroy_node(cur_node);
+                cur_node = next;
+            }
+            this->_retired[parity] = 0;
+            this->_retired_count[parity] = 0;
+        }
+    };
+}
+
+#endif
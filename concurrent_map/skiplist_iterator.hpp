@@ -0,0 +1,132 @@
+#ifndef SKIPLIST_ITERATOR
+#define SKIPLIST_ITERATOR
+
+#include <cstddef>
+#include "../iterator/iterator_traits.hpp"
+#include "sync.hpp"
+
+namespace ft {
+    // Lazy skiplist node. A node is in the map once fully_linked is set and
+    // until marked is set; both only ever go from 0 to 1. The lock guards
+    // the next pointers during updates and the mapped value at all times.
+    // next[] is allocated with top_level entries.
+    template<class Value>
+    struct skiplist_node {
+        typedef Value value_type;
+
+        union {
+            char raw[sizeof(Value)];
+            long double align_ld;
+            long long align_ll;
+            void *align_p;
+        } storage;
+        skiplist_node *retired;
+        spinlock lock;
+        int top_level;
+        int marked;
+        int fully_linked;
+        skiplist_node *next[1];
+
+        explicit skiplist_node(int levels) : retired(0), top_level(levels), marked(0), fully_linked(0) {
+            for (int i = 0; i < levels; i++)
+                this->next[i] = 0;
+        }
+
+        Value &value() {
+            return (*reinterpret_cast<Value *>(this->storage.raw));
+        }
+
+        bool live() const {
+            return (atomic_load(&this->fully_linked) != 0 && atomic_load(&this->marked) == 0);
+        }
+    };
+
+    // Weakly consistent: it sees every entry present for its whole lifetime
+    // and may or may not see concurrent changes. Each step copies the entry
+    // under the node's lock, so *it stays stable while other threads write.
+    // An iterator pins the epoch it started in, which keeps every node it
+    // could still reach allocated; do not hold one indefinitely.
+    template<class Value>
+    class skiplist_iterator {
+    public:
+        typedef const Value iterator_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename iterator_traits<iterator_type *>::value_type value_type;
+        typedef typename iterator_traits<iterator_type *>::pointer pointer;
+        typedef typename iterator_traits<iterator_type *>::reference reference;
+        typedef typename iterator_traits<iterator_type *>::difference_type difference_type;
+        typedef skiplist_node<Value> *node_pointer;
+
+    private:
+        epoch_guard _guard;
+        node_pointer _node_p;
+        Value _value;
+
+    public:
+        skiplist_iterator() : _node_p(0), _value() {}
+
+        skiplist_iterator(const epoch_guard &guard, node_pointer node_p) : _guard(guard), _node_p(node_p), _value() {
+            settle();
+        }
+
+        ~skiplist_iterator() {}
+
+        node_pointer base() const {
+            return (this->_node_p);
+        }
+
+        reference operator*() const {
+            return (this->_value);
+        }
+
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        skiplist_iterator &operator++() {
+            this->_node_p = atomic_load(&this->_node_p->next[0]);
+            settle();
+            return (*this);
+        }
+
+        skiplist_iterator operator++(int) {
+            skiplist_iterator tmp(*this);
+
+            ++(*this);
+            return (tmp);
+        }
+
+    private:
+        // Skips entries that are being inserted or are already erased. A
+        // removed node's next pointers are never changed, so walking on from
+        // one still reaches the rest of the list.
+        void settle() {
+            for (; this->_node_p != 0; this->_node_p = atomic_load(&this->_node_p->next[0])) {
+                if (atomic_load(&this->_node_p->fully_linked) == 0)
+                    continue;
+                this->_node_p->lock.lock();
+                bool removed = this->_node_p->marked != 0;
+                if (removed == false)
+                    this->_value = this->_node_p->value();
+                this->_node_p->lock.unlock();
+                if (removed == false)
+                    return;
+            }
+            this->_guard = epoch_guard();
+        }
+    };
+
+    template<typename Value>
+    bool operator==(const skiplist_iterator<Value> &lhs,
+                    const skiplist_iterator<Value> &rhs) {
+        return (lhs.base() == rhs.base());
+    }
+
+    template<typename Value>
+    bool operator!=(const skiplist_iterator<Value> &lhs,
+                    const skiplist_iterator<Value> &rhs) {
+        return (!(lhs == rhs));
+    }
+}
+
+#endif
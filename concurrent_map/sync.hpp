@@ -0,0 +1,141 @@
+#ifndef SYNC
+#define SYNC
+
+#include <sched.h>
+
+namespace ft {
+    // C++98 has no <atomic>; these wrap the __atomic builtins gcc and clang
+    // provide in every language mode.
+    template<class T>
+    inline T atomic_load(const T *p) {
+        return (__atomic_load_n(p, __ATOMIC_ACQUIRE));
+    }
+
+    template<class T>
+    inline void atomic_store(T *p, T v) {
+        __atomic_store_n(p, v, __ATOMIC_RELEASE);
+    }
+
+    template<class T>
+    inline T atomic_fetch_add(T *p, T v) {
+        return (__atomic_fetch_add(p, v, __ATOMIC_SEQ_CST));
+    }
+
+    template<class T>
+    inline T atomic_fetch_sub(T *p, T v) {
+        return (__atomic_fetch_sub(p, v, __ATOMIC_SEQ_CST));
+    }
+
+    template<class T>
+    inline T atomic_load_seq(const T *p) {
+        return (__atomic_load_n(p, __ATOMIC_SEQ_CST));
+    }
+
+    // Test-and-test-and-set; a waiter yields once the holder is clearly not
+    // about to let go.
+    class spinlock {
+    private:
+        int _flag;
+
+    public:
+        spinlock() : _flag(0) {}
+
+        void lock() {
+            while (__atomic_exchange_n(&this->_flag, 1, __ATOMIC_ACQUIRE) != 0) {
+                for (int spins = 0; __atomic_load_n(&this->_flag, __ATOMIC_RELAXED) != 0; spins++)
+                    if (spins > 64)
+                        sched_yield();
+            }
+        }
+
+        void unlock() {
+            __atomic_store_n(&this->_flag, 0, __ATOMIC_RELEASE);
+        }
+    };
+
+    // Epoch-based reclamation with two counters. An operation pins the
+    // current epoch e by counting itself in active[e % 2]; the epoch moves
+    // from e to e + 1 only once active[(e - 1) % 2] is zero. Memory unlinked
+    // during epoch e - 1 is then unreachable: every operation that could
+    // have seen it pinned e - 1 or earlier and has finished.
+    class epoch_domain {
+    private:
+        unsigned long _epoch;
+        unsigned long _active[2];
+
+    public:
+        epoch_domain() : _epoch(0) {
+            this->_active[0] = 0;
+            this->_active[1] = 0;
+        }
+
+        unsigned long enter() {
+            for (;;) {
+                unsigned long e = atomic_load_seq(&this->_epoch);
+
+                atomic_fetch_add(&this->_active[e & 1], 1UL);
+                if (atomic_load_seq(&this->_epoch) == e)
+                    return (e);
+                atomic_fetch_sub(&this->_active[e & 1], 1UL);
+            }
+        }
+
+        // Only valid while the caller already holds a pin on e.
+        void pin(unsigned long e) {
+            atomic_fetch_add(&this->_active[e & 1], 1UL);
+        }
+
+        void exit(unsigned long e) {
+            atomic_fetch_sub(&this->_active[e & 1], 1UL);
+        }
+
+        unsigned long epoch() const {
+            return (atomic_load_seq(&this->_epoch));
+        }
+
+        // Callers serialize this themselves. On success everything retired
+        // during the returned epoch's predecessor may be freed.
+        bool try_advance(unsigned long &from) {
+            unsigned long e = atomic_load_seq(&this->_epoch);
+
+            if (atomic_load_seq(&this->_active[(e + 1) & 1]) != 0)
+                return (false);
+            from = e;
+            atomic_fetch_add(&this->_epoch, 1UL);
+            return (true);
+        }
+    };
+
+    class epoch_guard {
+    private:
+        epoch_domain *_domain;
+        unsigned long _epoch;
+
+    public:
+        epoch_guard() : _domain(0), _epoch(0) {}
+
+        explicit epoch_guard(epoch_domain *domain) : _domain(domain), _epoch(domain->enter()) {}
+
+        epoch_guard(const epoch_guard &copy) : _domain(copy._domain), _epoch(copy._epoch) {
+            if (this->_domain != 0)
+                this->_domain->pin(this->_epoch);
+        }
+
+        epoch_guard &operator=(const epoch_guard &copy) {
+            if (copy._domain != 0)
+                copy._domain->pin(copy._epoch);
+            if (this->_domain != 0)
+                this->_domain->exit(this->_epoch);
+            this->_domain = copy._domain;
+            this->_epoch = copy._epoch;
+            return (*this);
+        }
+
+        ~epoch_guard() {
+            if (this->_domain != 0)
+                this->_domain->exit(this->_epoch);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,506 @@
+#ifndef FLAT_MAP
+#define FLAT_MAP
+
+#include <algorithm>
+#include "../util/util.hpp"
+#include "../map/pair_compare.hpp"
+#include "../vector/vector.hpp"
+
+namespace ft {
+    // A sorted run of pairs, binary searched by key. flat_map searches
+    // through one, and hands one to FT_TRANSPARENT_LOOKUP.
+    template<class Iterator, class ValueCompare>
+    class sorted_range {
+    private:
+        Iterator _first;
+        std::size_t _size;
+        ValueCompare _comp;
+
+    public:
+        sorted_range(Iterator first, std::size_t size, ValueCompare comp) : _first(first), _size(size), _comp(comp) {}
+
+        template<class K>
+        Iterator lower_bound(const K &k) const {
+            std::size_t first = 0;
+            std::size_t count = this->_size;
+
+            while (count > 0) {
+                std::size_t half = count / 2;
+
+                if (this->_comp(this->_first[first + half], k)) {
+                    first += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            return (this->_first + first);
+        }
+
+        template<class K>
+        Iterator upper_bound(const K &k) const {
+            std::size_t first = 0;
+            std::size_t count = this->_size;
+
+            while (count > 0) {
+                std::size_t half = count / 2;
+
+                if (this->_comp(k, this->_first[first + half]) == false) {
+                    first += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            return (this->_first + first);
+        }
+
+        template<class K>
+        Iterator find(const K &k) const {
+            Iterator it = lower_bound(k);
+            Iterator last = this->_first + this->_size;
+
+            if (it != last && this->_comp(k, *it))
+                return (last);
+            return (it);
+        }
+
+        template<class K>
+        std::size_t count(const K &k) const {
+            return (find(k) != this->_first + this->_size);
+        }
+
+        template<class K>
+        pair<Iterator, Iterator> equal_range(const K &k) const {
+            return (pair<Iterator, Iterator>(lower_bound(k), upper_bound(k)));
+        }
+    };
+
+    // A map kept as one sorted ft::vector: lookups are binary searches over
+    // contiguous memory and iteration is a pointer walk. Single inserts and
+    // erases shift the tail, so bulk changes go through insert(first, last),
+    // which sorts the batch once and merges it in a single pass.
+    template<class Key, class value, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, value> > >
+    class flat_map {
+    public:
+        typedef Key key_type;
+        typedef value mapped_type;
+
+        typedef pair<const Key, value> value_type;
+        typedef Compare key_compare;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef std::ptrdiff_t difference_type;
+        typedef std::size_t size_type;
+        typedef ft::pair_compare<value_type, Compare> value_compare;
+        typedef vector<value_type, allocator_type> storage_type;
+        typedef typename storage_type::iterator iterator;
+        typedef typename storage_type::const_iterator const_iterator;
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        key_compare _comp;
+        allocator_type _allocator;
+        storage_type _items;
+
+    public:
+        explicit flat_map(const key_compare &comp = key_compare(),
+                          const allocator_type &alloc = allocator_type()) : _comp(comp), _allocator(alloc),
+                                                                            _items(alloc) {}
+
+        template<class InputIterator>
+        flat_map(InputIterator first, InputIterator last,
+                 const key_compare &comp = key_compare(),
+                 const allocator_type &alloc = allocator_type())
+                : _comp(comp), _allocator(alloc), _items(alloc) {
+            insert(first, last);
+        }
+
+        flat_map(const flat_map &x) : _comp(x._comp), _allocator(x._allocator), _items(x._items) {}
+
+        flat_map &operator=(const flat_map &x) {
+            if (this != &x) {
+                this->_allocator = x._allocator;
+                this->_comp = x._comp;
+                this->_items = x._items;
+            }
+            return (*this);
+        }
+
+        ~flat_map() {}
+
+        iterator begin() {
+            return (this->_items.begin());
+        }
+
+        const_iterator begin() const {
+            return (this->_items.begin());
+        }
+
+        iterator end() {
+            return (this->_items.end());
+        }
+
+        const_iterator end() const {
+            return (this->_items.end());
+        }
+
+        reverse_iterator rbegin() {
+            return (reverse_iterator(end()));
+        }
+
+        const_reverse_iterator rbegin() const {
+            return (const_reverse_iterator(end()));
+        }
+
+        reverse_iterator rend() {
+            return (reverse_iterator(begin()));
+        }
+
+        const_reverse_iterator rend() const {
+            return (const_reverse_iterator(begin()));
+        }
+
+        bool empty() const {
+            return (this->_items.empty());
+        }
+
+        size_type size() const {
+            return (this->_items.size());
+        }
+
+        size_type max_size() const {
+            return (this->_items.max_size());
+        }
+
+        void reserve(size_type n) {
+            this->_items.reserve(n);
+        }
+
+        size_type capacity() const {
+            return (this->_items.capacity());
+        }
+
+        mapped_type &operator[](const key_type &k) {
+            size_type idx = find_index(k);
+
+            if (idx != size())
+                return (this->_items[idx].second);
+            return (try_emplace(k).first->second);
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k) {
+            return (try_emplace(k, mapped_type()));
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k, const mapped_type &obj) {
+            size_type idx = lower_bound_index(k);
+
+            if (idx != size() && this->_comp(k, this->_items[idx].first) == false)
+                return (pair<iterator, bool>(begin() + idx, false));
+            return (pair<iterator, bool>(this->_items.insert(begin() + idx, value_type(k, obj)), true));
+        }
+
+        pair<iterator, bool> insert_or_assign(const key_type &k, const mapped_type &obj) {
+            pair<iterator, bool> res = try_emplace(k, obj);
+
+            if (res.second == false)
+                res.first->second = obj;
+            return (res);
+        }
+
+        pair<iterator, bool> insert(const value_type &val) {
+            size_type idx = lower_bound_index(val.first);
+
+            if (idx != size() && this->_comp(val.first, this->_items[idx].first) == false)
+                return (pair<iterator, bool>(begin() + idx, false));
+            return (pair<iterator, bool>(this->_items.insert(begin() + idx, val), true));
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            if ((position == end() || this->_comp(val.first, position->first))
+                && (position == begin() || this->_comp((position - 1)->first, val.first)))
+                return (this->_items.insert(position, val));
+            return (insert(val).first);
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            storage_type batch(this->_allocator);
+
+            for (; first != last; ++first)
+                batch.push_back(*first);
+            if (batch.empty())
+                return;
+            if (is_strictly_sorted(batch) == false)
+                std::stable_sort(batch.begin(), batch.end(), value_comp());
+            if (empty()) {
+                unique_into(batch, this->_items);
+                return;
+            }
+
+            storage_type merged(this->_allocator);
+            size_type i = 0;
+            size_type j = 0;
+
+            merged.reserve(size() + batch.size());
+            while (i != size() || j != batch.size()) {
+                if (j == batch.size() || (i != size() && this->_comp(this->_items[i].first, batch[j].first))) {
+                    merged.push_back(this->_items[i++]);
+                } else {
+                    if (i == size() || this->_comp(batch[j].first, this->_items[i].first))
+                        merged.push_back(batch[j]);
+                    else
+                        merged.push_back(this->_items[i++]);
+                    size_type k = j++;
+                    while (j != batch.size() && this->_comp(batch[k].first, batch[j].first) == false)
+                        j++;
+                }
+            }
+            this->_items.swap(merged);
+        }
+
+        void erase(iterator position) {
+            this->_items.erase(position);
+        }
+
+        size_type erase(const key_type &k) {
+            iterator it = find(k);
+
+            if (it == end())
+                return (0);
+            this->_items.erase(it);
+            return (1);
+        }
+
+        void erase(iterator first, iterator last) {
+            this->_items.erase(first, last);
+        }
+
+        void swap(flat_map &x) {
+            std::swap(this->_comp, x._comp);
+            std::swap(this->_allocator, x._allocator);
+            this->_items.swap(x._items);
+        }
+
+        void clear() {
+            this->_items.clear();
+        }
+
+        key_compare key_comp() const {
+            return (this->_comp);
+        }
+
+        value_compare value_comp() const {
+            return (value_compare(this->_comp));
+        }
+
+        iterator find(const key_type &k) {
+            return (begin() + find_index(k));
+        }
+
+        const_iterator find(const key_type &k) const {
+            return (begin() + find_index(k));
+        }
+
+        size_type count(const key_type &k) const {
+            return (find_index(k) != size());
+        }
+
+        iterator lower_bound(const key_type &k) {
+            return (begin() + lower_bound_index(k));
+        }
+
+        const_iterator lower_bound(const key_type &k) const {
+            return (begin() + lower_bound_index(k));
+        }
+
+        iterator upper_bound(const key_type &k) {
+            return (begin() + upper_bound_index(k));
+        }
+
+        const_iterator upper_bound(const key_type &k) const {
+            return (begin() + upper_bound_index(k));
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &k) {
+            return (pair<iterator, iterator>(lower_bound(k), upper_bound(k)));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const {
+            return (pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));
+        }
+
+        FT_TRANSPARENT_LOOKUP(this->sorted())
+
+        iterator nth(size_type k) {
+            return (begin() + std::min(k, size()));
+        }
+
+        const_iterator nth(size_type k) const {
+            return (begin() + std::min(k, size()));
+        }
+
+        size_type rank(const key_type &k) const {
+            return (lower_bound_index(k));
+        }
+
+        difference_type distance(const_iterator first, const_iterator last) const {
+            return (last - first);
+        }
+
+        void split(const key_type &k, flat_map &other) {
+            if (this == &other)
+                return;
+            iterator first = lower_bound(k);
+
+            other.clear();
+            other._comp = this->_comp;
+            other._items.reserve(static_cast<size_type>(end() - first));
+            for (iterator it = first; it != end(); ++it)
+                other._items.push_back(*it);
+            this->_items.erase(first, end());
+        }
+
+        void join(flat_map &other) {
+            if (this == &other || other.empty())
+                return;
+            if (empty() || this->_comp(this->_items[size() - 1].first, other._items[0].first)) {
+                this->_items.reserve(size() + other.size());
+                for (size_type i = 0; i < other.size(); i++)
+                    this->_items.push_back(other._items[i]);
+            } else {
+                insert(other.begin(), other.end());
+            }
+            other.clear();
+        }
+
+        void set_union(const flat_map &other) {
+            if (this != &other)
+                insert(other.begin(), other.end());
+        }
+
+        void set_intersection(const flat_map &other) {
+            if (this != &other)
+                filter(other, true);
+        }
+
+        void set_difference(const flat_map &other) {
+            if (this == &other)
+                clear();
+            else
+                filter(other, false);
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
+    private:
+        sorted_range<iterator, value_compare> sorted() {
+            return (sorted_range<iterator, value_compare>(begin(), size(), value_comp()));
+        }
+
+        sorted_range<const_iterator, value_compare> sorted() const {
+            return (sorted_range<const_iterator, value_compare>(begin(), size(), value_comp()));
+        }
+
+        template<class K>
+        size_type lower_bound_index(const K &k) const {
+            return (static_cast<size_type>(sorted().lower_bound(k) - begin()));
+        }
+
+        template<class K>
+        size_type upper_bound_index(const K &k) const {
+            return (static_cast<size_type>(sorted().upper_bound(k) - begin()));
+        }
+
+        template<class K>
+        size_type find_index(const K &k) const {
+            return (static_cast<size_type>(sorted().find(k) - begin()));
+        }
+
+        bool is_strictly_sorted(const storage_type &items) const {
+            for (size_type i = 1; i < items.size(); i++) {
+                if (this->_comp(items[i - 1].first, items[i].first) == false)
+                    return (false);
+            }
+            return (true);
+        }
+
+        void unique_into(const storage_type &sorted, storage_type &dest) const {
+            dest.reserve(sorted.size());
+            for (size_type i = 0; i < sorted.size(); i++) {
+                if (i == 0 || this->_comp(sorted[i - 1].first, sorted[i].first))
+                    dest.push_back(sorted[i]);
+            }
+        }
+
+        void filter(const flat_map &other, bool keep_common) {
+            storage_type kept(this->_allocator);
+            size_type j = 0;
+
+            kept.reserve(size());
+            for (size_type i = 0; i < size(); i++) {
+                while (j != other.size() && this->_comp(other._items[j].first, this->_items[i].first))
+                    j++;
+                bool common = j != other.size() && this->_comp(this->_items[i].first, other._items[j].first) == false;
+                if (common == keep_common)
+                    kept.push_back(this->_items[i]);
+            }
+            this->_items.swap(kept);
+        }
+
+    public:
+        template<class _Key, class _T, class _Compare, class _Alloc>
+        friend bool operator==(const flat_map<_Key, _T, _Compare, _Alloc> &lhs,
+                               const flat_map<_Key, _T, _Compare, _Alloc> &rhs);
+
+        template<class _Key, class _T, class _Compare, class _Alloc>
+        friend bool operator<(const flat_map<_Key, _T, _Compare, _Alloc> &lhs,
+                              const flat_map<_Key, _T, _Compare, _Alloc> &rhs);
+    };
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator==(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs) {
+        return (lhs._items == rhs._items);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator!=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator<(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs) {
+        return (lhs._items < rhs._items);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator>(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs) {
+        return (rhs < lhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator<=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs) {
+        return !(lhs > rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator>=(const flat_map<Key, T, Compare, Alloc> &lhs, const flat_map<Key, T, Compare, Alloc> &rhs) {
+        return !(lhs < rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    void swap(flat_map<Key, T, Compare, Alloc> &lhs, flat_map<Key, T, Compare, Alloc> &rhs) {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
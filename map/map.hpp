@@ -2,10 +2,12 @@
 #define ITERATOR_TRAITS
 
 #include "../util/util.hpp"
+#include "pair_compare.hpp"
 #include "tree.hpp"
 
 namespace ft {
-    template<class Key, class value, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, value> > >
+    template<class Key, class value, class Compare = std::less<Key>, class Allocator = std::allocator<pair<const Key, value> >,
+            class NodeUpdate = null_node_update>
     class map {
     public:
         typedef Key key_type;
@@ -25,23 +27,9 @@ namespace ft {
 
         typedef std::ptrdiff_t difference_type;
         typedef std::size_t size_type;
-        class pair_compare {
-            friend class map;
-        protected:
-            Compare comp;
-            pair_compare(Compare c) : comp(c) {}
-        public:
-            pair_compare() {}
-            typedef bool result_type;
-            typedef value_type first_argument_type;
-            typedef value_type second_argument_type;
-            bool operator()(const value_type &x, const value_type &y) const {
-                return comp(x.first, y.first);
-            }
-        };
-
-        typedef pair_compare value_compare;
-        typedef tree<value_type, pair_compare, allocator_type> tree_type;
+        typedef ft::pair_compare<value_type, Compare> value_compare;
+        typedef NodeUpdate node_update;
+        typedef tree<value_type, value_compare, allocator_type, node_update> tree_type;
         typedef typename tree_type::iterator iterator;
         typedef typename tree_type::const_iterator const_iterator;
         typedef typename tree_type::reverse_iterator reverse_iterator;
@@ -49,34 +37,39 @@ namespace ft {
 
     private:
         key_compare _comp;
-        allocator_type _allocator;
         tree_type _tree;
         
     public:
         explicit map(const key_compare &comp = key_compare(),
-                     const allocator_type &alloc = allocator_type()) : _comp(comp), _allocator(alloc),
-                                                                       _tree(tree_type(comp, alloc)) {}
+                     const allocator_type &alloc = allocator_type()) : _comp(comp), _tree(comp, alloc) {}
 
         template<class InputIterator>
         map(InputIterator first, InputIterator last,
             const key_compare &comp = key_compare(),
             const allocator_type &alloc = allocator_type())
-                :_comp(comp), _allocator(alloc), _tree(first, last, comp, alloc) {}
+                :_comp(comp), _tree(first, last, comp, alloc) {}
 
-        map(const map &x) {
-            this->_comp = x._comp;
-            this->_allocator = x._allocator;
-            this->_tree = x._tree;
-        }
+        map(const map &x) : _comp(x._comp), _tree(x._tree) {}
 
         map &operator=(const map &x) {
             if (this != &x) {
-                this->_allocator = x._allocator;
                 this->_comp = x._comp;
                 this->_tree = x._tree;
             }
             return (*this);
         }
+#if FT_HAS_MOVE
+
+        map(map &&x) : _comp(x._comp), _tree(std::move(x._tree)) {}
+
+        map &operator=(map &&x) {
+            if (this != &x) {
+                this->_comp = x._comp;
+                this->_tree = std::move(x._tree);
+            }
+            return (*this);
+        }
+#endif
 
         ~map(){}
 
@@ -125,7 +118,25 @@ namespace ft {
         }
 
         mapped_type &operator[](const key_type &k) {
-            return (*((this->insert(ft::make_pair(k, mapped_type()))).first)).second;
+            return (this->_tree.try_emplace(k).first->second);
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k) {
+            return (this->_tree.try_emplace(k));
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k, const mapped_type &obj) {
+            return (this->_tree.try_emplace(k, obj));
+        }
+
+        pair<iterator, bool> insert_or_assign(const key_type &k, const mapped_type &obj) {
+            pair<iterator, bool> res = this->_tree.try_emplace(k, obj);
+
+            if (res.second == false) {
+                res.first->second = obj;
+                this->_tree.refresh(res.first);
+            }
+            return (res);
         }
 
         pair<iterator, bool> insert(const value_type &val) {
@@ -135,6 +146,17 @@ namespace ft {
         iterator insert(iterator position, const value_type &val) {
             return (this->_tree.insert(position, val));
         }
+#if FT_HAS_MOVE
+
+        pair<iterator, bool> insert(value_type &&val) {
+            return (this->_tree.insert(std::move(val)));
+        }
+
+        template<class... Args>
+        pair<iterator, bool> emplace(Args &&... args) {
+            return (this->_tree.emplace(std::forward<Args>(args)...));
+        }
+#endif
 
         template<class InputIterator>
         void insert(InputIterator first, InputIterator last) {
@@ -147,7 +169,7 @@ namespace ft {
 
         size_type erase(const key_type &k) {
 
-            return (this->_tree.erase(ft::make_pair(k, mapped_type())));
+            return (this->_tree.erase(k));
         }
 
         void erase(iterator first, iterator last) {
@@ -171,88 +193,138 @@ namespace ft {
         }
 
         iterator find(const key_type &k) {
-            return (this->_tree.find(ft::make_pair(k, mapped_type())));
+            return (this->_tree.find(k));
         }
 
         const_iterator find(const key_type &k) const {
-            return (this->_tree.find(ft::make_pair(k, mapped_type())));
+            return (this->_tree.find(k));
         }
 
         size_type count(const key_type &k) const {
-            return (this->_tree.count(ft::make_pair(k, mapped_type())));
+            return (this->_tree.count(k));
         }
 
         iterator lower_bound(const key_type &k) {
-            return (this->_tree.lower_bound(ft::make_pair(k, mapped_type())));
+            return (this->_tree.lower_bound(k));
         }
 
         const_iterator lower_bound(const key_type &k) const {
-            return (this->_tree.lower_bound(ft::make_pair(k, mapped_type())));
+            return (this->_tree.lower_bound(k));
         }
 
         iterator upper_bound(const key_type &k) {
-            return (this->_tree.upper_bound(ft::make_pair(k, mapped_type())));
+            return (this->_tree.upper_bound(k));
         }
 
         const_iterator upper_bound(const key_type &k) const {
-            return (this->_tree.upper_bound(ft::make_pair(k, mapped_type())));
+            return (this->_tree.upper_bound(k));
         }
 
         pair<iterator, iterator> equal_range(const key_type &k) {
-            return (this->_tree.equal_range(ft::make_pair(k, mapped_type())));
+            return (this->_tree.equal_range(k));
         }
 
         pair<const_iterator, const_iterator> equal_range(const key_type &k) const {
-            return (this->_tree.equal_range(ft::make_pair(k, mapped_type())));
+            return (this->_tree.equal_range(k));
         }
 
+        FT_TRANSPARENT_LOOKUP(this->_tree)
+
+        iterator nth(size_type k) {
+            return (this->_tree.nth(k));
+        }
+
+        const_iterator nth(size_type k) const {
+            return (this->_tree.nth(k));
+        }
+
+        size_type rank(const key_type &k) const {
+            return (this->_tree.rank(k));
+        }
+
+        difference_type distance(const_iterator first, const_iterator last) const {
+            return (this->_tree.distance(first, last));
+        }
+
+        // O(log n). Without tree_order_statistics, both maps count their size
+        // on the next size() call.
+        void split(const key_type &k, map &other) {
+            this->_tree.split(k, other._tree);
+        }
+
+        void join(map &other) {
+            this->_tree.join(other._tree);
+        }
+
+        void set_union(const map &other) {
+            this->_tree.set_union(other._tree);
+        }
+
+        void set_intersection(const map &other) {
+            this->_tree.set_intersection(other._tree);
+        }
+
+        void set_difference(const map &other) {
+            this->_tree.set_difference(other._tree);
+        }
+
+        // Combines the mapped values of the keys in [lo, hi), in key order;
+        // an empty range, lo >= hi included, gives result_type().
+        template<class K>
+        typename aggregate_result<node_update, K>::type aggregate(const K &lo, const K &hi) const {
+            return (this->_tree.aggregate(lo, hi));
+        }
+
+        void refresh(iterator position) {
+            this->_tree.refresh(position);
+        }
 
         allocator_type get_allocator() const {
-            return (this->_allocator);
+            return (this->_tree.get_allocator());
         }
 
-        template<class _Key, class _T, class _Compare, class _Alloc>
-        friend bool operator==(const map<_Key, _T, _Compare, _Alloc> &lhs,
-                               const map<_Key, _T, _Compare, _Alloc> &rhs);
+        template<class _Key, class _T, class _Compare, class _Alloc, class _Update>
+        friend bool operator==(const map<_Key, _T, _Compare, _Alloc, _Update> &lhs,
+                               const map<_Key, _T, _Compare, _Alloc, _Update> &rhs);
 
-        template<class _Key, class _T, class _Compare, class _Alloc>
-        friend bool operator<(const map<_Key, _T, _Compare, _Alloc> &lhs,
-                              const map<_Key, _T, _Compare, _Alloc> &rhs);
+        template<class _Key, class _T, class _Compare, class _Alloc, class _Update>
+        friend bool operator<(const map<_Key, _T, _Compare, _Alloc, _Update> &lhs,
+                              const map<_Key, _T, _Compare, _Alloc, _Update> &rhs);
 
     };
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator==(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    bool operator==(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         return (lhs._tree == rhs._tree);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator!=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    bool operator!=(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         return !(lhs == rhs);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator<(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    bool operator<(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         return (lhs._tree < rhs._tree);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator>(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    bool operator>(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         return (rhs < lhs);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator<=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    bool operator<=(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         return !(lhs > rhs);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    bool operator>=(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    bool operator>=(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         return !(lhs < rhs);
     }
 
-    template<class Key, class T, class Compare, class Alloc>
-    void swap(const map<Key, T, Compare, Alloc> &lhs, const map<Key, T, Compare, Alloc> &rhs) {
+    template<class Key, class T, class Compare, class Alloc, class Update>
+    void swap(const map<Key, T, Compare, Alloc, Update> &lhs, const map<Key, T, Compare, Alloc, Update> &rhs) {
         lhs.swap(rhs);
     }
 }
@@ -0,0 +1,73 @@
+#ifndef NODE_UPDATE
+#define NODE_UPDATE
+
+#include <cstddef>
+
+namespace ft {
+    // A node update policy mixes metadata_type into every tree node and
+    // recomputes it from the node's children; the tree calls it whenever a
+    // node's children change (insert, erase and all four rotations).
+    struct null_node_update {
+        struct metadata_type {
+        };
+
+        template<class NodePtr>
+        void operator()(NodePtr) const {}
+    };
+
+    struct tree_order_statistics {
+        struct metadata_type {
+            std::size_t subtree_size;
+
+            metadata_type() : subtree_size(0) {}
+        };
+
+        template<class NodePtr>
+        void operator()(NodePtr node) const {
+            node->subtree_size = 1;
+            if (node->left != 0)
+                node->subtree_size += node->left->subtree_size;
+            if (node->right != 0)
+                node->subtree_size += node->right->subtree_size;
+        }
+    };
+
+    // Caches Combine over the mapped values of every subtree so a key range
+    // can be folded in O(log n). Combine must be associative and expose
+    // result_type; it is never assumed to be commutative. The cache only
+    // follows changes the tree sees: after writing a mapped value in place
+    // (operator[], iterators), call refresh() on its iterator, or use
+    // insert_or_assign() which does so.
+    template<class Combine>
+    struct tree_aggregate {
+        typedef typename Combine::result_type result_type;
+
+        struct metadata_type {
+            result_type subtree_aggregate;
+
+            metadata_type() : subtree_aggregate() {}
+        };
+
+        Combine combine;
+
+        tree_aggregate(const Combine &c = Combine()) : combine(c) {}
+
+        template<class NodePtr>
+        void operator()(NodePtr node) const {
+            result_type res = node->value.second;
+
+            if (node->left != 0)
+                res = this->combine(node->left->subtree_aggregate, res);
+            if (node->right != 0)
+                res = this->combine(res, node->right->subtree_aggregate);
+            node->subtree_aggregate = res;
+        }
+    };
+
+    template<class NodeUpdate, class Key>
+    struct aggregate_result {
+        typedef typename NodeUpdate::result_type type;
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef PAIR_COMPARE
+#define PAIR_COMPARE
+
+#include "../util/util.hpp"
+
+namespace ft {
+    // The value_compare of the ordered maps: orders pairs by their first
+    // member, and compares a bare key against a pair either way round so the
+    // containers can search by key.
+    template<class Value, class Compare>
+    class pair_compare {
+    protected:
+        Compare comp;
+
+    public:
+        typedef bool result_type;
+        typedef Value first_argument_type;
+        typedef Value second_argument_type;
+
+        pair_compare() {}
+
+        pair_compare(Compare c) : comp(c) {}
+
+        bool operator()(const Value &x, const Value &y) const {
+            return comp(x.first, y.first);
+        }
+
+        template<class K>
+        bool operator()(const K &x, const Value &y) const {
+            return comp(x, y.first);
+        }
+
+        template<class K>
+        bool operator()(const Value &x, const K &y) const {
+            return comp(x.first, y);
+        }
+    };
+}
+
+// The heterogeneous find, count, lower_bound, upper_bound and equal_range of
+// an ordered map, declared only when key_compare is transparent. impl is the
+// object that does the searching; it needs the same five members as
+// templates on the key type, with const and non-const versions.
+#define FT_TRANSPARENT_LOOKUP(impl) \
+        template<class K> \
+        iterator find(const K &k, typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) { \
+            return (impl.find(k)); \
+        } \
+        \
+        template<class K> \
+        const_iterator find(const K &k, typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) const { \
+            return (impl.find(k)); \
+        } \
+        \
+        template<class K> \
+        size_type count(const K &k, typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) const { \
+            return (impl.count(k)); \
+        } \
+        \
+        template<class K> \
+        iterator lower_bound(const K &k, typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) { \
+            return (impl.lower_bound(k)); \
+        } \
+        \
+        template<class K> \
+        const_iterator lower_bound(const K &k, \
+                                   typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) const { \
+            return (impl.lower_bound(k)); \
+        } \
+        \
+        template<class K> \
+        iterator upper_bound(const K &k, typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) { \
+            return (impl.upper_bound(k)); \
+        } \
+        \
+        template<class K> \
+        const_iterator upper_bound(const K &k, \
+                                   typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) const { \
+            return (impl.upper_bound(k)); \
+        } \
+        \
+        template<class K> \
+        pair<iterator, iterator> equal_range(const K &k, \
+                                             typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) { \
+            return (impl.equal_range(k)); \
+        } \
+        \
+        template<class K> \
+        pair<const_iterator, const_iterator> equal_range(const K &k, \
+                                                         typename enable_if<is_transparent<key_compare>::value, K>::type * = 0) const { \
+            return (impl.equal_range(k)); \
+        }
+
+#endif
@@ -1,19 +1,24 @@
 #ifndef TREE
 #define TREE
 
+#include <new>
+#include <limits>
 #include "../util/util.hpp"
 #include "../iterator/reverse_iterator.hpp"
 #include "tree_iterator.hpp"
 
 namespace ft {
 
-    template<class Value, class Compare, class Allocator = std::allocator<Value> >
+    template<class Value, class Compare, class Allocator = std::allocator<Value>, class NodeUpdate = null_node_update>
     class tree {
     public:
         typedef Value value_type;
         typedef Compare value_compare;
+        typedef NodeUpdate node_update;
+        typedef typename node_update::metadata_type metadata_type;
+        typedef Node<Value, metadata_type> node_type;
 
-        typedef typename Allocator::template rebind<Node<Value> >::other node_allocator;
+        typedef typename Allocator::template rebind<node_type>::other node_allocator;
         typedef typename node_allocator::pointer node_pointer;
 
         typedef Allocator allocator_type;
@@ -24,8 +29,8 @@ namespace ft {
         typedef typename allocator_type::difference_type difference_type;
         typedef typename allocator_type::size_type size_type;
 
-        typedef tree_iterator<value_type> iterator;
-        typedef tree_iterator<const value_type> const_iterator;
+        typedef tree_iterator<value_type, metadata_type> iterator;
+        typedef tree_iterator<const value_type, metadata_type> const_iterator;
 
         typedef ft::reverse_iterator<iterator> reverse_iterator;
         typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
@@ -33,60 +38,123 @@ namespace ft {
 
     private:
         value_compare _comp;
+        node_update _update;
         allocator_type _allocator;
         node_allocator _node_alloc;
+        // _super_root is end(): its left is the root, its right caches the rightmost node
         node_pointer _super_root;
         node_pointer _root;
-        size_type _size;
+        node_pointer _leftmost;
+        // After a split without subtree sizes, _size is counted on demand
+        mutable size_type _size;
+        mutable bool _size_known;
 
     public:
-        tree() : _comp(value_compare()) {
+        tree() : _comp(value_compare()), _node_alloc(this->_allocator) {
             this->_root = 0;
             this->_size = 0;
-            this->_super_root = this->_node_alloc.allocate(1);
-            this->_node_alloc.construct(this->_super_root, Node<value_type>());
+            this->_size_known = true;
+            init_super_root();
         }
 
         tree(const value_compare &comp,
              const allocator_type &alloc = allocator_type()) :
-                _comp(comp), _allocator(alloc), _node_alloc(node_allocator()), _root(0), _size(0) {
-            this->_super_root = this->_node_alloc.allocate(1);
-            this->_node_alloc.construct(this->_super_root, Node<value_type>());
+                _comp(comp), _allocator(alloc), _node_alloc(alloc), _root(0), _size(0), _size_known(true) {
+            init_super_root();
         }
 
         template<class InputIterator>
         tree(InputIterator first, InputIterator last,
              const value_compare &comp,
              const allocator_type &alloc = allocator_type()):
-                _comp(comp), _allocator(alloc), _node_alloc(node_allocator()) {
+                _comp(comp), _allocator(alloc), _node_alloc(alloc) {
             this->_size = 0;
+            this->_size_known = true;
             this->_root = 0;
-            this->_super_root = this->_node_alloc.allocate(1);
-            this->_node_alloc.construct(this->_super_root, Node<value_type>());
-
-            insert(first, last);
+            init_super_root();
+
+            try {
+                insert(first, last);
+            } catch (...) {
+                clear();
+                this->_node_alloc.destroy(this->_super_root);
+                this->_node_alloc.deallocate(this->_super_root, 1);
+                throw;
+            }
         }
 
-        tree(const value_type &copy) {
-            *this = copy;
+        tree(const tree &copy) :
+                _comp(copy._comp), _allocator(select_on_copy(copy._allocator)), _node_alloc(this->_allocator),
+                _root(0), _size(0), _size_known(true) {
+            init_super_root();
+
+            try {
+                *this = copy;
+            } catch (...) {
+                this->_node_alloc.destroy(this->_super_root);
+                this->_node_alloc.deallocate(this->_super_root, 1);
+                throw;
+            }
         }
 
         tree &operator=(const tree &copy) {
             if (this == &copy)
                 return (*this);
             this->_comp = copy._comp;
-            this->_node_alloc = copy._node_alloc;
 
-            if (this->_root != 0)
-                this->clear();
-            if (this->_super_root == 0) {
-                this->_super_root = this->_node_alloc.allocate(1);
-                this->_node_alloc.construct(this->_super_root, Node<value_type>());
+            node_pointer reuse = this->_root;
+            if (reuse != 0)
+                reuse->parent = 0;
+            this->_root = 0;
+            this->_super_root->left = 0;
+            this->_super_root->right = 0;
+            this->_leftmost = this->_super_root;
+
+            if (copy._root != 0) {
+                try {
+                    this->_root = clone_node(copy._root, this->_super_root, reuse);
+                } catch (...) {
+                    this->_root = 0;
+                    this->_size = 0;
+                    this->_size_known = true;
+                    while (reuse != 0 && reuse->parent != 0)
+                        reuse = reuse->parent;
+                    destroy_nodes(reuse);
+                    throw;
+                }
+                this->_super_root->left = this->_root;
+                this->_leftmost = this->_root;
+                while (this->_leftmost->left != 0)
+                    this->_leftmost = this->_leftmost->left;
+                this->_super_root->right = this->_root;
+                while (this->_super_root->right->right != 0)
+                    this->_super_root->right = this->_super_root->right->right;
             }
+            this->_size = copy._size;
+            this->_size_known = copy._size_known;
 
-            this->insert(copy.begin(), copy.end());
+            while (reuse != 0 && reuse->parent != 0)
+                reuse = reuse->parent;
+            destroy_nodes(reuse);
             return (*this);
         }
+#if FT_HAS_MOVE
+
+        tree(tree &&x) :
+                _comp(x._comp), _allocator(x._allocator), _node_alloc(x._node_alloc), _root(0), _size(0), _size_known(true) {
+            init_super_root();
+
+            this->swap(x);
+        }
+
+        tree &operator=(tree &&x) {
+            if (this != &x) {
+                this->clear();
+                this->swap(x);
+            }
+            return (*this);
+        }
+#endif
 
         ~tree()
         {
@@ -95,23 +163,11 @@ namespace ft {
             this->_node_alloc.deallocate(this->_super_root, 1);
         }
         iterator begin() {
-            if (this->_root == 0)
-                return (iterator(this->_super_root));
-            node_pointer cur_node = this->_root;
-
-            while (cur_node->left != 0)
-                cur_node = cur_node->left;
-            return (iterator(cur_node));
+            return (iterator(this->_leftmost));
         }
 
         const_iterator begin() const {
-            if (this->_root == 0)
-                return (const_iterator(this->_super_root));
-            node_pointer cur_node = this->_root;
-
-            while (cur_node->left != 0)
-                cur_node = cur_node->left;
-            return (const_iterator(cur_node));
+            return (const_iterator(this->_leftmost));
         }
 
         iterator end() {
@@ -138,141 +194,398 @@ namespace ft {
             return (const_reverse_iterator(begin()));
         }
 
+        // The sentinel is recognised by its null parent, which must be set
+        // here: the node may come from memory an allocator has reused.
+        void init_super_root() {
+            this->_super_root = this->_node_alloc.allocate(1);
+            this->_node_alloc.construct(this->_super_root, node_type());
+            this->_super_root->parent = 0;
+            this->_super_root->left = 0;
+            this->_super_root->right = 0;
+            this->_leftmost = this->_super_root;
+        }
+
         node_pointer create_value(const value_type &v) {
             node_pointer tmp_node = this->_node_alloc.allocate(1);
-            this->_node_alloc.construct(tmp_node, Node<value_type>(v));
+            try {
+                construct_value(tmp_node, v);
+            } catch (...) {
+                this->_node_alloc.deallocate(tmp_node, 1);
+                throw;
+            }
             return (tmp_node);
         }
 
-        ft::pair<iterator, bool> insert(const value_type &val) {
-            node_pointer new_node = create_value(val);
+        void construct_value(node_pointer new_node, const value_type &v) {
+            ::new (static_cast<void *>(static_cast<metadata_type *>(new_node))) metadata_type();
+            this->_allocator.construct(&new_node->value, v);
+            new_node->parent = 0;
+            new_node->left = 0;
+            new_node->right = 0;
+            new_node->height = 1;
+        }
+#if FT_HAS_MOVE
 
-            if (this->_root == 0) {
-                this->_size++;
-                this->_root = new_node;
-                this->_super_root->left = this->_root;
-                this->_root->parent = this->_super_root;
-                return (ft::pair<iterator, bool>(iterator(new_node), true));
+        node_pointer create_value(value_type &&v) {
+            node_pointer tmp_node = this->_node_alloc.allocate(1);
+            try {
+                construct_value(tmp_node, std::move(v));
+            } catch (...) {
+                this->_node_alloc.deallocate(tmp_node, 1);
+                throw;
+            }
+            return (tmp_node);
+        }
+
+        void construct_value(node_pointer new_node, value_type &&v) {
+            ::new (static_cast<void *>(static_cast<metadata_type *>(new_node))) metadata_type();
+            this->_allocator.construct(&new_node->value, std::move(v));
+            new_node->parent = 0;
+            new_node->left = 0;
+            new_node->right = 0;
+            new_node->height = 1;
+        }
+#endif
+
+        node_pointer take_node(node_pointer &reuse) {
+            node_pointer cur_node = reuse;
+
+            if (cur_node == 0)
+                return (0);
+            while (cur_node->left != 0 || cur_node->right != 0)
+                cur_node = (cur_node->left != 0) ? cur_node->left : cur_node->right;
+            reuse = cur_node->parent;
+            if (reuse != 0) {
+                if (reuse->left == cur_node)
+                    reuse->left = 0;
+                else
+                    reuse->right = 0;
+            }
+            return (cur_node);
+        }
+
+        void destroy_nodes(node_pointer rest) {
+            while (rest != 0) {
+                if (rest->left != 0) {
+                    node_pointer l_node = rest->left;
+                    rest->left = l_node->right;
+                    l_node->right = rest;
+                    rest = l_node;
+                } else {
+                    node_pointer r_node = rest->right;
+                    this->_node_alloc.destroy(rest);
+                    this->_node_alloc.deallocate(rest, 1);
+                    rest = r_node;
+                }
+            }
+        }
+
+        node_pointer clone_node(node_pointer src, node_pointer parent, node_pointer &reuse) {
+            node_pointer new_node = take_node(reuse);
+
+            if (new_node == 0) {
+                new_node = create_value(src->value);
+            } else {
+                this->_node_alloc.destroy(new_node);
+                try {
+                    construct_value(new_node, src->value);
+                } catch (...) {
+                    this->_node_alloc.deallocate(new_node, 1);
+                    throw;
+                }
+            }
+            new_node->parent = parent;
+            // A copy that throws frees this subtree; the caller frees the
+            // rest of reuse.
+            try {
+                if (src->left != 0)
+                    new_node->left = clone_node(src->left, new_node, reuse);
+                if (src->right != 0)
+                    new_node->right = clone_node(src->right, new_node, reuse);
+            } catch (...) {
+                destroy_nodes(new_node);
+                throw;
+            }
+            update_node(new_node);
+            return (new_node);
+        }
+
+        node_pointer attach_node(node_pointer new_node, node_pointer p_node, bool is_left) {
+            new_node->parent = p_node;
+            this->_update(new_node);
+            if (p_node == this->_super_root) {
+                p_node->left = new_node;
+                p_node->right = new_node;
+                this->_leftmost = new_node;
+            } else if (is_left) {
+                p_node->left = new_node;
+                if (p_node == this->_leftmost)
+                    this->_leftmost = new_node;
+            } else {
+                p_node->right = new_node;
+                if (p_node == this->_super_root->right)
+                    this->_super_root->right = new_node;
+            }
+            this->_size++;
+            e_rebalance(p_node);
+            return (new_node);
+        }
+
+        template<class Key>
+        ft::pair<node_pointer, bool> find_parent(const Key &k, bool &is_left) const {
+            node_pointer p_node = this->_super_root;
+            node_pointer cur_node = this->_root;
+
+            is_left = true;
+            while (cur_node != 0) {
+                p_node = cur_node;
+                if (this->_comp(k, cur_node->value)) {
+                    is_left = true;
+                    cur_node = cur_node->left;
+                } else if (this->_comp(cur_node->value, k)) {
+                    is_left = false;
+                    cur_node = cur_node->right;
+                } else {
+                    return (ft::make_pair(cur_node, true));
+                }
             }
+            return (ft::make_pair(p_node, false));
+        }
 
+        // find_parent for keys probed in ascending order. finger is a node
+        // not after k, or _super_root to start at the root; the search climbs
+        // from it only to the lowest ancestor whose subtree spans k, and
+        // leaves it on the last node before k that it passed. A sorted run of
+        // m probes into n nodes so costs O(m log(n/m)) rather than O(m log n).
+        template<class Key>
+        ft::pair<node_pointer, bool> find_parent_from(node_pointer &finger, const Key &k, bool &is_left) const {
+            node_pointer p_node = this->_super_root;
             node_pointer cur_node = this->_root;
 
+            if (finger != this->_super_root) {
+                cur_node = finger;
+                while (cur_node->parent != this->_super_root
+                       && (cur_node == cur_node->parent->right || this->_comp(k, cur_node->parent->value) == false))
+                    cur_node = cur_node->parent;
+            }
+            is_left = true;
             while (cur_node != 0) {
-                if (new_node->value.first == cur_node->value.first) {
-                    return (ft::pair<iterator, bool>(iterator(cur_node), false));
-                } else if (this->_comp(new_node->value, cur_node->value)) {
-                    if (cur_node->left == 0) {
-                        cur_node->left = new_node;
-                        new_node->parent = cur_node;
-                        break;
-                    } else {
-                        cur_node = cur_node->left;
-                    }
+                p_node = cur_node;
+                if (this->_comp(k, cur_node->value)) {
+                    is_left = true;
+                    cur_node = cur_node->left;
+                } else if (this->_comp(cur_node->value, k)) {
+                    is_left = false;
+                    finger = cur_node;
+                    cur_node = cur_node->right;
                 } else {
-                    if (cur_node->right == 0) {
-                        cur_node->right = new_node;
-                        new_node->parent = cur_node;
-                        break;
-                    } else {
-                        cur_node = cur_node->right;
-                    }
+                    return (ft::make_pair(cur_node, true));
                 }
             }
-            update_node_height(new_node);
-            rebalance(find_rebalance_node(new_node));
-            this->_size++;
-            ft::pair<iterator, bool> res(iterator(new_node), true);
-            return (res);
+            return (ft::make_pair(p_node, false));
+        }
+
+        ft::pair<iterator, bool> insert(const value_type &val) {
+            bool is_left;
+            ft::pair<node_pointer, bool> pos = find_parent(val, is_left);
+
+            if (pos.second)
+                return (ft::pair<iterator, bool>(iterator(pos.first), false));
+            return (ft::pair<iterator, bool>(iterator(attach_node(create_value(val), pos.first, is_left)), true));
+        }
+#if FT_HAS_MOVE
+
+        ft::pair<iterator, bool> insert(value_type &&val) {
+            bool is_left;
+            ft::pair<node_pointer, bool> pos = find_parent(val, is_left);
+
+            if (pos.second)
+                return (ft::pair<iterator, bool>(iterator(pos.first), false));
+            return (ft::pair<iterator, bool>(iterator(attach_node(create_value(std::move(val)), pos.first, is_left)),
+                                             true));
+        }
+
+        // The value is built before the lookup, so an existing key costs a
+        // temporary but no node allocation.
+        template<class... Args>
+        ft::pair<iterator, bool> emplace(Args &&... args) {
+            return (insert(value_type(std::forward<Args>(args)...)));
+        }
+#endif
+
+        template<class Key>
+        ft::pair<iterator, bool> try_emplace(const Key &k) {
+            bool is_left;
+            ft::pair<node_pointer, bool> pos = find_parent(k, is_left);
+
+            if (pos.second)
+                return (ft::pair<iterator, bool>(iterator(pos.first), false));
+            node_pointer new_node = create_value(value_type(k, typename value_type::second_type()));
+            return (ft::pair<iterator, bool>(iterator(attach_node(new_node, pos.first, is_left)), true));
+        }
+
+        template<class Key, class Mapped>
+        ft::pair<iterator, bool> try_emplace(const Key &k, const Mapped &obj) {
+            bool is_left;
+            ft::pair<node_pointer, bool> pos = find_parent(k, is_left);
+
+            if (pos.second)
+                return (ft::pair<iterator, bool>(iterator(pos.first), false));
+            node_pointer new_node = create_value(value_type(k, obj));
+            return (ft::pair<iterator, bool>(iterator(attach_node(new_node, pos.first, is_left)), true));
         }
 
         iterator insert(iterator position, const value_type &val) {
-            iterator tmp = position;
+            node_pointer pos_node = position.base();
+            node_pointer rightmost = this->_super_root->right;
+
+            if (pos_node == this->_super_root) {
+                if (this->_root != 0 && this->_comp(rightmost->value, val))
+                    return (iterator(attach_node(create_value(val), rightmost, false)));
+            } else if (this->_comp(val, pos_node->value)) {
+                if (pos_node == this->_leftmost)
+                    return (iterator(attach_node(create_value(val), pos_node, true)));
+                node_pointer prev_node = (--iterator(pos_node)).base();
+                if (this->_comp(prev_node->value, val)) {
+                    if (prev_node->right == 0)
+                        return (iterator(attach_node(create_value(val), prev_node, false)));
+                    return (iterator(attach_node(create_value(val), pos_node, true)));
+                }
+            } else if (this->_comp(pos_node->value, val)) {
+                if (pos_node == rightmost)
+                    return (iterator(attach_node(create_value(val), pos_node, false)));
+                node_pointer next_node = (++iterator(pos_node)).base();
+                if (this->_comp(val, next_node->value)) {
+                    if (pos_node->right == 0)
+                        return (iterator(attach_node(create_value(val), pos_node, false)));
+                    return (iterator(attach_node(create_value(val), next_node, true)));
+                }
+            } else {
+                return (position);
+            }
             return (insert(val).first);
         }
 
         template<class InputIterator>
         void insert(InputIterator first, InputIterator last) {
+            insert_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+        }
+
+        template<class InputIterator>
+        void insert_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
             for (; first != last; ++first) {
-                insert(*first);
+                insert(end(), *first);
+            }
+        }
+
+        template<class ForwardIterator>
+        void insert_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+            if (this->_root != 0 || is_strictly_sorted(first, last) == false)
+                return (insert_range(first, last, std::input_iterator_tag()));
+
+            size_type n = static_cast<size_type>(std::distance(first, last));
+            if (n == 0)
+                return;
+            this->_root = build_sorted(first, n, this->_super_root);
+            this->_super_root->left = this->_root;
+            this->_leftmost = this->_root;
+            while (this->_leftmost->left != 0)
+                this->_leftmost = this->_leftmost->left;
+            this->_super_root->right = this->_root;
+            while (this->_super_root->right->right != 0)
+                this->_super_root->right = this->_super_root->right->right;
+            this->_size = n;
+            this->_size_known = true;
+        }
+
+        template<class ForwardIterator>
+        bool is_strictly_sorted(ForwardIterator first, ForwardIterator last) const {
+            if (first == last)
+                return (true);
+            for (ForwardIterator next = first; ++next != last; ++first) {
+                const value_type &prev_value = *first;
+                const value_type &next_value = *next;
+
+                if (this->_comp(prev_value, next_value) == false)
+                    return (false);
+            }
+            return (true);
+        }
+
+        template<class ForwardIterator>
+        node_pointer build_sorted(ForwardIterator &first, size_type n, node_pointer parent) {
+            if (n == 0)
+                return (0);
+            node_pointer l_node = build_sorted(first, n / 2, 0);
+            node_pointer new_node;
+            try {
+                new_node = create_value(*first);
+            } catch (...) {
+                destroy_nodes(l_node);
+                throw;
+            }
+
+            new_node->parent = parent;
+            new_node->left = l_node;
+            new_node->right = 0;
+            if (l_node != 0)
+                l_node->parent = new_node;
+            try {
+                ++first;
+                new_node->right = build_sorted(first, n - n / 2 - 1, new_node);
+            } catch (...) {
+                destroy_nodes(new_node);
+                throw;
             }
+            update_node(new_node);
+            return (new_node);
         }
 
         void erase(iterator position) {
             node_pointer cur_node = position.base();
-            node_pointer p_node = cur_node->parent;
-
-            if (cur_node == this->_root && cur_node->left == 0 && cur_node->right == 0) {
-                this->_root = 0;
-                this->_super_root->left = 0;
-                this->_size--;
-                this->_node_alloc.destroy(cur_node);
-                this->_node_alloc.deallocate(cur_node, 1);
-            } else if (cur_node->left == 0 && cur_node->right == 0) {
-                if (cur_node == p_node->left)
-                    p_node->left = 0;
-                else
-                    p_node->right = 0;
-                p_node->height--;
-                e_rebalance(p_node);
-                this->_size--;
-                this->_node_alloc.destroy(cur_node);
-                this->_node_alloc.deallocate(cur_node, 1);
-            } else if (cur_node->left != 0 && cur_node->right != 0) {
-                node_pointer child_node = (--position).base();
-                cur_node->value = child_node->value;
-
-                if (child_node->parent->left == child_node) {
-                    if (child_node->left != 0) {
-                        child_node->parent->left = child_node->left;
-                        child_node->left->parent = child_node->parent;
-                    } else {
-                        child_node->parent->left = 0;
-                    }
-                } else {
-                    if (child_node->left != 0) {
-                        child_node->parent->right = child_node->left;
-                        child_node->left->parent = child_node->parent;
-                    } else {
-                        child_node->parent->right = 0;
-                    }
-                }
-                e_rebalance(child_node);
-                this->_size--;
-                this->_node_alloc.destroy(child_node);
-                this->_node_alloc.deallocate(child_node, 1);
-            } else if (cur_node->left != 0 && cur_node->right == 0) {
-                if (cur_node == p_node->left) {
-                    p_node->left = cur_node->left;
-                    cur_node->left->parent = p_node;
-                } else if (cur_node == p_node->right) {
-                    p_node->right = cur_node->left;
-                    cur_node->left->parent = p_node;
-                }
-                if (cur_node == this->_root)
-                    this->_root = cur_node->left;
-                e_rebalance(cur_node->left);
-                this->_size--;
-                this->_node_alloc.destroy(cur_node);
-                this->_node_alloc.deallocate(cur_node, 1);
-            } else if (cur_node->left == 0 && cur_node->right != 0) {
-                if (cur_node == p_node->left) {
-                    p_node->left = cur_node->right;
-                    cur_node->right->parent = p_node;
-                } else if (cur_node == p_node->right) {
-                    p_node->right = cur_node->right;
-                    cur_node->right->parent = p_node;
+
+            unlink_node(cur_node);
+            this->_node_alloc.destroy(cur_node);
+            this->_node_alloc.deallocate(cur_node, 1);
+        }
+
+        void unlink_node(node_pointer cur_node) {
+            node_pointer fix_node = cur_node->parent;
+
+            if (cur_node == this->_super_root->right)
+                this->_super_root->right = (cur_node == this->_leftmost) ? 0 : (--iterator(cur_node)).base();
+            if (cur_node == this->_leftmost)
+                this->_leftmost = (++iterator(cur_node)).base();
+
+            if (cur_node->left == 0) {
+                transplant(cur_node, cur_node->right);
+            } else if (cur_node->right == 0) {
+                transplant(cur_node, cur_node->left);
+            } else {
+                node_pointer next_node = cur_node->right;
+
+                while (next_node->left != 0)
+                    next_node = next_node->left;
+                fix_node = next_node;
+                if (next_node->parent != cur_node) {
+                    fix_node = next_node->parent;
+                    transplant(next_node, next_node->right);
+                    next_node->right = cur_node->right;
+                    next_node->right->parent = next_node;
                 }
-                if (cur_node == this->_root)
-                    this->_root = cur_node->right;
-                e_rebalance(cur_node->right);
-                this->_size--;
-                this->_node_alloc.destroy(cur_node);
-                this->_node_alloc.deallocate(cur_node, 1);
+                transplant(cur_node, next_node);
+                next_node->left = cur_node->left;
+                next_node->left->parent = next_node;
+                next_node->height = cur_node->height;
             }
+            this->_root = this->_super_root->left;
+            e_rebalance(fix_node);
+            this->_size--;
         }
 
-        size_type erase(const value_type &v) {
-            node_pointer item = search(v);
+        template<class Key>
+        size_type erase(const Key &k) {
+            node_pointer item = search(k);
             if (item == this->_super_root) {
                 return (0);
             } else {
@@ -287,33 +600,47 @@ namespace ft {
                 erase(first++);
         }
 
-        node_pointer search(const value_type &v) const {
-            const_iterator iter = this->begin();
+        template<class Key>
+        node_pointer search(const Key &k) const {
+            node_pointer cur_node = this->_root;
 
-            while (iter.base() != this->_super_root) {
-                if (iter->first == v.first)
-                    break;
-                ++iter;
+            while (cur_node != 0) {
+                if (this->_comp(k, cur_node->value))
+                    cur_node = cur_node->left;
+                else if (this->_comp(cur_node->value, k))
+                    cur_node = cur_node->right;
+                else
+                    return (cur_node);
             }
-            return (iter.base());
+            return (this->_super_root);
         }
 
-        iterator find(const value_type &value) {
-            node_pointer find_res = search(value);
-            return (find_res == NULL ? end() : iterator(find_res));
+        template<class Key>
+        iterator find(const Key &k) {
+            return (iterator(search(k)));
         }
 
-        const_iterator find(const value_type &value) const {
-            node_pointer find_res = search(value);
-            return (find_res == NULL ? end() : const_iterator(find_res));
+        template<class Key>
+        const_iterator find(const Key &k) const {
+            return (const_iterator(search(k)));
         }
 
-        size_type count(const value_type &value) const {
-            return (find(value) != end());
+        template<class Key>
+        size_type count(const Key &k) const {
+            return (find(k) != end());
         }
 
         void clear() {
-            erase(this->begin(), this->end());
+            if (this->_root == 0)
+                return;
+            this->_root->parent = 0;
+            destroy_nodes(this->_root);
+            this->_root = 0;
+            this->_super_root->left = 0;
+            this->_super_root->right = 0;
+            this->_leftmost = this->_super_root;
+            this->_size = 0;
+            this->_size_known = true;
         }
 
         size_type max_size() const {
@@ -340,98 +667,74 @@ namespace ft {
             return (lsh - rsh);
         }
 
-        void update_node_height(node_pointer new_node) {
-            node_pointer cur_node = new_node;
-            node_pointer p_node = new_node->parent;
-            int root_value = cur_node->height;
-            root_value++;
-            while (p_node != this->_super_root) {
-                if (cur_node == p_node->left) {
-                    if (p_node->right && p_node->right->height >= root_value)
-                        break;
-                } else if (cur_node == p_node->right) {
-                    if (p_node->left && p_node->left->height >= root_value)
-                        break;
-                }
-                p_node->height = root_value;
-                cur_node = cur_node->parent;
-                p_node = p_node->parent;
-                root_value++;
-            }
+        void update_node(node_pointer cur_node) {
+            int lsh = 0;
+            int rsh = 0;
+
+            if (cur_node->left != 0)
+                lsh = cur_node->left->height;
+            if (cur_node->right != 0)
+                rsh = cur_node->right->height;
+            cur_node->height = std::max(lsh, rsh) + 1;
+            this->_update(cur_node);
         }
 
-        node_pointer find_rebalance_node(node_pointer new_node) {
-            node_pointer cur_node = new_node;
-            int balance_factor = 0;
-            while (cur_node != this->_super_root) {
-                balance_factor = get_height_diff(cur_node);
-                if (balance_factor > 1 || balance_factor < -1) {
-                    break;
-                }
-                cur_node = cur_node->parent;
-            }
-            return (cur_node);
+        void transplant(node_pointer old_node, node_pointer new_node) {
+            if (old_node->parent == 0)
+                ;
+            else if (old_node->parent->left == old_node)
+                old_node->parent->left = new_node;
+            else
+                old_node->parent->right = new_node;
+            if (new_node != 0)
+                new_node->parent = old_node->parent;
         }
 
         node_pointer rebalance(node_pointer cur_node) {
-            node_pointer result_node = 0;
-
-            if (cur_node == this->_super_root || cur_node == 0)
-                return 0;
-
             int h_diff = get_height_diff(cur_node);
+
             if (h_diff > 1) {
-                if (get_height_diff(cur_node->left) > 0) {
-                    result_node = rotateLL(cur_node);
-                    update_node_height(result_node);
-                } else {
-                    result_node = rotateLR(cur_node);
-                    update_node_height(result_node);
-                }
+                if (get_height_diff(cur_node->left) >= 0)
+                    return (rotateLL(cur_node));
+                return (rotateLR(cur_node));
             } else if (h_diff < -1) {
-                if (get_height_diff(cur_node->right) < 0) {
-                    result_node = rotateRR(cur_node);
-                    update_node_height(result_node);
-                } else {
-                    result_node = rotateRL(cur_node);
-                    update_node_height(result_node);
-                }
+                if (get_height_diff(cur_node->right) <= 0)
+                    return (rotateRR(cur_node));
+                return (rotateRL(cur_node));
             }
-            this->_root = this->_super_root->left;
-            return (result_node);
+            update_node(cur_node);
+            return (cur_node);
         }
 
         void e_rebalance(node_pointer cur_node) {
-            node_pointer tmp_node = cur_node;
+            while (cur_node != this->_super_root) {
+                int old_height = cur_node->height;
 
-            while (tmp_node != this->_super_root && tmp_node != 0) {
-                update_node_height(tmp_node);
-                tmp_node = rebalance(find_rebalance_node(tmp_node));
-                if (tmp_node != this->_super_root && tmp_node != 0)
-                    tmp_node = tmp_node->parent;
+                cur_node = rebalance(cur_node);
+                if (cur_node->height == old_height)
+                    break;
+                cur_node = cur_node->parent;
+            }
+            if (ft::is_same<node_update, null_node_update>::value == false && cur_node != this->_super_root) {
+                for (cur_node = cur_node->parent; cur_node != this->_super_root; cur_node = cur_node->parent)
+                    this->_update(cur_node);
             }
+            this->_root = this->_super_root->left;
         }
 
         node_pointer rotateLL(node_pointer cur_node) {
             node_pointer p_node = cur_node;
             node_pointer c_node = p_node->left;
 
-            p_node->height -= 2;
-            if (c_node->right != 0) {
-                p_node->left = c_node->right;
+            p_node->left = c_node->right;
+            if (c_node->right != 0)
                 c_node->right->parent = p_node;
-            } else {
-                p_node->left = 0;
-            }
-
-            if (p_node->parent->left == p_node)
-                p_node->parent->left = c_node;
-            else
-                p_node->parent->right = c_node;
-            c_node->parent = p_node->parent;
+            transplant(p_node, c_node);
 
             c_node->right = p_node;
             p_node->parent = c_node;
+            update_node(p_node);
+            update_node(c_node);
             return (c_node);
         }
 
@@ -439,51 +742,44 @@ namespace ft {
             node_pointer p_node = cur_node;
             node_pointer c_node = p_node->right;
 
-            p_node->height -= 2;
-            if (c_node->left != 0) {
-                p_node->right = c_node->left;
+            p_node->right = c_node->left;
+            if (c_node->left != 0)
                 c_node->left->parent = p_node;
-            } else {
-                p_node->right = 0;
-            }
-
-            if (p_node->parent->left == p_node)
-                p_node->parent->left = c_node;
-            else
-                p_node->parent->right = c_node;
-            c_node->parent = p_node->parent;
+            transplant(p_node, c_node);
 
             c_node->left = p_node;
             p_node->parent = c_node;
+            update_node(p_node);
+            update_node(c_node);
             return (c_node);
         }
 
         node_pointer rotateLR(node_pointer cur_node) {
-            node_pointer p_node = cur_node;
-            node_pointer c_node = p_node->left;
-
-            c_node->height += 1;
-            c_node->right->height += 1;
-            p_node->left = rotateRR(c_node);
-            return (rotateLL(p_node));
+            rotateRR(cur_node->left);
+            return (rotateLL(cur_node));
         }
 
         node_pointer rotateRL(node_pointer cur_node) {
-            node_pointer p_node = cur_node;
-            node_pointer c_node = p_node->right;
-
-            c_node->height += 1;
-            c_node->left->height += 1;
-            p_node->right = rotateLL(c_node);
-            return (rotateRR(p_node));
+            rotateLL(cur_node->right);
+            return (rotateRR(cur_node));
         }
 
         size_type size() const {
+            if (this->_size_known == false) {
+                this->_size = 0;
+                for (const_iterator it = begin(); it != end(); ++it)
+                    this->_size++;
+                this->_size_known = true;
+            }
             return (this->_size);
         }
 
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
         bool empty() const {
-            if (this->_size == 0)
+            if (this->_root == 0)
                 return (true);
             else
                 return (false);
@@ -491,81 +787,563 @@ namespace ft {
 
         void swap(tree &x) {
             std::swap(this->_comp, x._comp);
+            std::swap(this->_update, x._update);
             std::swap(this->_allocator, x._allocator);
             std::swap(this->_node_alloc, x._node_alloc);
 
             std::swap(this->_super_root, x._super_root);
             std::swap(this->_root, x._root);
+            std::swap(this->_leftmost, x._leftmost);
             std::swap(this->_size, x._size);
+            std::swap(this->_size_known, x._size_known);
         }
 
-        iterator lower_bound(const value_type &v) {
-            iterator it = begin();
+        template<class Key>
+        void split(const Key &k, tree &other) {
+            if (this == &other)
+                return;
+            other.clear();
+            other._comp = this->_comp;
+            other._update = this->_update;
+            if (this->_node_alloc != other._node_alloc) {
+                iterator first = lower_bound(k);
+                other.insert(first, end());
+                erase(first, end());
+                return;
+            }
+            if (this->_root == 0)
+                return;
+
+            node_pointer l_node;
+            node_pointer r_node;
+            this->_root->parent = 0;
+            split_nodes(this->_root, k, l_node, r_node);
+            other.adopt_root(r_node, 0);
+            adopt_root(l_node, 0);
+            split_sizes(other, static_cast<node_update *>(0));
+        }
 
-            for (; it != end(); it++) {
-                if (this->_comp(*it, v) == false)
-                    break;
+        void join(tree &other) {
+            node_pointer mid_node = 0;
+            node_pointer l_node = 0;
+            node_pointer r_node = 0;
+
+            if (this == &other || other._root == 0)
+                return;
+            if (this->_node_alloc == other._node_alloc) {
+                if (this->_root == 0 || this->_comp(this->_super_root->right->value, other._leftmost->value)) {
+                    mid_node = other._leftmost;
+                    other.unlink_node(mid_node);
+                    l_node = this->_root;
+                    r_node = other._root;
+                } else if (this->_comp(other._super_root->right->value, this->_leftmost->value)) {
+                    mid_node = other._super_root->right;
+                    other.unlink_node(mid_node);
+                    l_node = other._root;
+                    r_node = this->_root;
+                }
             }
-            return (it);
+            if (mid_node == 0) {
+                insert(other.begin(), other.end());
+                other.clear();
+                return;
+            }
+
+            size_type n = this->_size + other._size + 1;
+            bool size_known = this->_size_known && other._size_known;
+            if (l_node != 0)
+                l_node->parent = 0;
+            if (r_node != 0)
+                r_node->parent = 0;
+            other.adopt_root(0, 0);
+            adopt_root(join_nodes(l_node, mid_node, r_node), n);
+            this->_size_known = size_known;
         }
 
-        const_iterator lower_bound(const value_type &v) const {
-            const_iterator it = begin();
+        void set_union(const tree &other) {
+            if (this == &other || other._root == 0)
+                return;
+            if (probe_cheaper(other.size(), size())) {
+                node_pointer finger = this->_super_root;
 
-            for (; it != end(); it++) {
-                if (this->_comp(*it, v) == false)
-                    break;
+                for (const_iterator it = other.begin(); it != other.end(); ++it) {
+                    bool is_left;
+                    ft::pair<node_pointer, bool> pos = find_parent_from(finger, *it, is_left);
+
+                    finger = pos.second ? pos.first : attach_node(create_value(*it), pos.first, is_left);
+                }
+                return;
             }
-            return (it);
+
+            node_pointer cur_node = flatten_nodes(this->_root);
+            node_pointer head = 0;
+            node_pointer *tail = &head;
+            size_type n = 0;
+            const_iterator it = other.begin();
+            try {
+                while (cur_node != 0 || it != other.end()) {
+                    node_pointer next_node;
+
+                    if (it == other.end() || (cur_node != 0 && this->_comp(cur_node->value, *it))) {
+                        next_node = cur_node;
+                        cur_node = cur_node->right;
+                    } else if (cur_node == 0 || this->_comp(*it, cur_node->value)) {
+                        next_node = create_value(*it);
+                        ++it;
+                    } else {
+                        next_node = cur_node;
+                        cur_node = cur_node->right;
+                        ++it;
+                    }
+                    *tail = next_node;
+                    tail = &next_node->right;
+                    n++;
+                }
+            } catch (...) {
+                for (*tail = cur_node; cur_node != 0; cur_node = cur_node->right)
+                    n++;
+                adopt_root(build_list(head, n, 0), n);
+                throw;
+            }
+            *tail = 0;
+            adopt_root(build_list(head, n, 0), n);
         }
 
-        iterator upper_bound(const value_type &v) {
-            iterator it = begin();
+        void set_intersection(const tree &other) {
+            if (this == &other)
+                return;
+            if (other._root == 0) {
+                clear();
+                return;
+            }
+
+            bool probe = probe_cheaper(size(), other.size());
+            node_pointer finger = other._super_root;
+            node_pointer cur_node = flatten_nodes(this->_root);
+            node_pointer head = 0;
+            node_pointer *tail = &head;
+            size_type n = 0;
+            const_iterator it = other.begin();
+            while (cur_node != 0) {
+                node_pointer next_node = cur_node;
+                bool keep;
+                bool is_left;
 
-            for (; it != end(); it++) {
-                if (this->_comp(v, *it) == true)
-                    break;
+                cur_node = cur_node->right;
+                if (probe) {
+                    keep = other.find_parent_from(finger, next_node->value, is_left).second;
+                } else {
+                    while (it != other.end() && this->_comp(*it, next_node->value))
+                        ++it;
+                    keep = it != other.end() && this->_comp(next_node->value, *it) == false;
+                }
+                if (keep) {
+                    *tail = next_node;
+                    tail = &next_node->right;
+                    n++;
+                } else {
+                    this->_node_alloc.destroy(next_node);
+                    this->_node_alloc.deallocate(next_node, 1);
+                }
+            }
+            *tail = 0;
+            adopt_root(build_list(head, n, 0), n);
+        }
+
+        void set_difference(const tree &other) {
+            if (this == &other) {
+                clear();
+                return;
+            }
+            if (other._root == 0)
+                return;
+            if (probe_cheaper(other.size(), size())) {
+                node_pointer finger = this->_super_root;
+
+                for (const_iterator it = other.begin(); it != other.end(); ++it) {
+                    bool is_left;
+                    ft::pair<node_pointer, bool> pos = find_parent_from(finger, *it, is_left);
+
+                    if (pos.second)
+                        erase(iterator(pos.first));
+                }
+                return;
+            }
+
+            bool probe = probe_cheaper(size(), other.size());
+            node_pointer finger = other._super_root;
+            node_pointer cur_node = flatten_nodes(this->_root);
+            node_pointer head = 0;
+            node_pointer *tail = &head;
+            size_type n = 0;
+            const_iterator it = other.begin();
+            while (cur_node != 0) {
+                node_pointer next_node = cur_node;
+                bool keep;
+                bool is_left;
+
+                cur_node = cur_node->right;
+                if (probe) {
+                    keep = other.find_parent_from(finger, next_node->value, is_left).second == false;
+                } else {
+                    while (it != other.end() && this->_comp(*it, next_node->value))
+                        ++it;
+                    keep = it == other.end() || this->_comp(next_node->value, *it);
+                }
+                if (keep) {
+                    *tail = next_node;
+                    tail = &next_node->right;
+                    n++;
+                } else {
+                    this->_node_alloc.destroy(next_node);
+                    this->_node_alloc.deallocate(next_node, 1);
+                }
+            }
+            *tail = 0;
+            adopt_root(build_list(head, n, 0), n);
+        }
+
+        // k finger probes into n nodes cost about k * log2(n / k) steps, one
+        // merge pass about n.
+        bool probe_cheaper(size_type k, size_type n) const {
+            size_type depth = 1;
+
+            for (size_type ratio = (k == 0) ? n : n / k; ratio > 1; ratio >>= 1)
+                depth++;
+            return (k * depth < n);
+        }
+
+        node_pointer flatten_nodes(node_pointer rest) {
+            node_pointer head = 0;
+            node_pointer *tail = &head;
+
+            while (rest != 0) {
+                if (rest->left != 0) {
+                    node_pointer l_node = rest->left;
+                    rest->left = l_node->right;
+                    l_node->right = rest;
+                    rest = l_node;
+                } else {
+                    *tail = rest;
+                    tail = &rest->right;
+                    rest = rest->right;
+                }
             }
-            return (it);
+            return (head);
         }
 
-        const_iterator upper_bound(const value_type &v) const {
-            const_iterator it = begin();
+        node_pointer build_list(node_pointer &head, size_type n, node_pointer parent) {
+            if (n == 0)
+                return (0);
+            node_pointer l_node = build_list(head, n / 2, 0);
+            node_pointer new_node = head;
+            head = head->right;
+
+            new_node->parent = parent;
+            new_node->left = l_node;
+            if (l_node != 0)
+                l_node->parent = new_node;
+            new_node->right = build_list(head, n - n / 2 - 1, new_node);
+            update_node(new_node);
+            return (new_node);
+        }
+
+        int node_height(node_pointer cur_node) const {
+            return (cur_node == 0 ? 0 : cur_node->height);
+        }
+
+        node_pointer join_nodes(node_pointer l_node, node_pointer mid_node, node_pointer r_node) {
+            if (node_height(l_node) > node_height(r_node) + 1) {
+                l_node->right = join_nodes(l_node->right, mid_node, r_node);
+                l_node->right->parent = l_node;
+                return (rebalance(l_node));
+            }
+            if (node_height(r_node) > node_height(l_node) + 1) {
+                r_node->left = join_nodes(l_node, mid_node, r_node->left);
+                r_node->left->parent = r_node;
+                return (rebalance(r_node));
+            }
+            mid_node->parent = 0;
+            mid_node->left = l_node;
+            mid_node->right = r_node;
+            if (l_node != 0)
+                l_node->parent = mid_node;
+            if (r_node != 0)
+                r_node->parent = mid_node;
+            update_node(mid_node);
+            return (mid_node);
+        }
+
+        template<class Key>
+        void split_nodes(node_pointer cur_node, const Key &k, node_pointer &l_node, node_pointer &r_node) {
+            if (cur_node == 0) {
+                l_node = 0;
+                r_node = 0;
+                return;
+            }
+
+            node_pointer l_child = cur_node->left;
+            node_pointer r_child = cur_node->right;
+            if (l_child != 0)
+                l_child->parent = 0;
+            if (r_child != 0)
+                r_child->parent = 0;
+            if (this->_comp(cur_node->value, k)) {
+                split_nodes(r_child, k, l_node, r_node);
+                l_node = join_nodes(l_child, cur_node, l_node);
+            } else {
+                split_nodes(l_child, k, l_node, r_node);
+                r_node = join_nodes(r_node, cur_node, r_child);
+            }
+        }
+
+        void split_sizes(tree &other, tree_order_statistics *) {
+            this->_size = subtree_size(this->_root);
+            other._size = subtree_size(other._root);
+        }
 
-            for (; it != end(); it++) {
-                if (this->_comp(v, *it) == true)
+        // Without subtree sizes, sizing either half takes a walk over it:
+        // leave both to size() rather than make the split linear.
+        template<class Policy>
+        void split_sizes(tree &other, Policy *) {
+            this->_size_known = false;
+            other._size_known = false;
+        }
+
+        node_pointer min_node(node_pointer cur_node) const {
+            while (cur_node != 0 && cur_node->left != 0)
+                cur_node = cur_node->left;
+            return (cur_node);
+        }
+
+        node_pointer next_node(node_pointer cur_node) const {
+            if (cur_node->right != 0)
+                return (min_node(cur_node->right));
+            while (cur_node->parent != 0 && cur_node == cur_node->parent->right)
+                cur_node = cur_node->parent;
+            return (cur_node->parent);
+        }
+
+        void adopt_root(node_pointer root_node, size_type n) {
+            this->_root = root_node;
+            this->_size = n;
+            this->_super_root->left = root_node;
+            this->_super_root->right = root_node;
+            this->_leftmost = this->_super_root;
+            if (root_node == 0)
+                return;
+            root_node->parent = this->_super_root;
+            this->_leftmost = min_node(root_node);
+            while (this->_super_root->right->right != 0)
+                this->_super_root->right = this->_super_root->right->right;
+        }
+
+        size_type subtree_size(node_pointer cur_node) const {
+            return (cur_node == 0 ? 0 : cur_node->subtree_size);
+        }
+
+        iterator nth(size_type k) {
+            return (iterator(nth_node(k)));
+        }
+
+        const_iterator nth(size_type k) const {
+            return (const_iterator(nth_node(k)));
+        }
+
+        node_pointer nth_node(size_type k) const {
+            node_pointer cur_node = this->_root;
+
+            if (k >= size())
+                return (this->_super_root);
+            while (k != subtree_size(cur_node->left)) {
+                if (k < subtree_size(cur_node->left)) {
+                    cur_node = cur_node->left;
+                } else {
+                    k -= subtree_size(cur_node->left) + 1;
+                    cur_node = cur_node->right;
+                }
+            }
+            return (cur_node);
+        }
+
+        template<class Key>
+        size_type rank(const Key &k) const {
+            node_pointer cur_node = this->_root;
+            size_type res = 0;
+
+            while (cur_node != 0) {
+                if (this->_comp(cur_node->value, k)) {
+                    res += subtree_size(cur_node->left) + 1;
+                    cur_node = cur_node->right;
+                } else {
+                    cur_node = cur_node->left;
+                }
+            }
+            return (res);
+        }
+
+        size_type index_of(const_iterator position) const {
+            node_pointer cur_node = position.base();
+
+            if (cur_node == this->_super_root)
+                return (size());
+            size_type res = subtree_size(cur_node->left);
+            for (; cur_node->parent != this->_super_root; cur_node = cur_node->parent) {
+                if (cur_node == cur_node->parent->right)
+                    res += subtree_size(cur_node->parent->left) + 1;
+            }
+            return (res);
+        }
+
+        difference_type distance(const_iterator first, const_iterator last) const {
+            return (static_cast<difference_type>(index_of(last)) - static_cast<difference_type>(index_of(first)));
+        }
+
+        template<class Key>
+        typename aggregate_result<node_update, Key>::type aggregate(const Key &lo, const Key &hi) const {
+            typedef typename aggregate_result<node_update, Key>::type result_type;
+            node_pointer split_node = this->_root;
+
+            while (split_node != 0) {
+                if (this->_comp(split_node->value, lo))
+                    split_node = split_node->right;
+                else if (this->_comp(split_node->value, hi) == false)
+                    split_node = split_node->left;
+                else
                     break;
             }
-            return (it);
+            if (split_node == 0)
+                return (result_type());
+
+            result_type res = split_node->value.second;
+            for (node_pointer cur_node = split_node->left; cur_node != 0;) {
+                if (this->_comp(cur_node->value, lo)) {
+                    cur_node = cur_node->right;
+                } else {
+                    result_type part = cur_node->value.second;
+                    if (cur_node->right != 0)
+                        part = this->_update.combine(part, cur_node->right->subtree_aggregate);
+                    res = this->_update.combine(part, res);
+                    cur_node = cur_node->left;
+                }
+            }
+            for (node_pointer cur_node = split_node->right; cur_node != 0;) {
+                if (this->_comp(cur_node->value, hi)) {
+                    result_type part = cur_node->value.second;
+                    if (cur_node->left != 0)
+                        part = this->_update.combine(cur_node->left->subtree_aggregate, part);
+                    res = this->_update.combine(res, part);
+                    cur_node = cur_node->right;
+                } else {
+                    cur_node = cur_node->left;
+                }
+            }
+            return (res);
+        }
+
+        void refresh(iterator position) {
+            if (ft::is_same<node_update, null_node_update>::value)
+                return;
+            for (node_pointer cur_node = position.base(); cur_node != this->_super_root; cur_node = cur_node->parent)
+                this->_update(cur_node);
+        }
+
+        template<class Key>
+        node_pointer lower_bound_node(node_pointer cur_node, node_pointer res_node, const Key &k) const {
+            while (cur_node != 0) {
+                if (this->_comp(cur_node->value, k) == false) {
+                    res_node = cur_node;
+                    cur_node = cur_node->left;
+                } else {
+                    cur_node = cur_node->right;
+                }
+            }
+            return (res_node);
+        }
+
+        template<class Key>
+        node_pointer upper_bound_node(node_pointer cur_node, node_pointer res_node, const Key &k) const {
+            while (cur_node != 0) {
+                if (this->_comp(k, cur_node->value) == true) {
+                    res_node = cur_node;
+                    cur_node = cur_node->left;
+                } else {
+                    cur_node = cur_node->right;
+                }
+            }
+            return (res_node);
+        }
+
+        template<class Key>
+        pair<node_pointer, node_pointer> equal_range_node(const Key &k) const {
+            node_pointer cur_node = this->_root;
+            node_pointer res_node = this->_super_root;
+
+            while (cur_node != 0) {
+                if (this->_comp(k, cur_node->value)) {
+                    res_node = cur_node;
+                    cur_node = cur_node->left;
+                } else if (this->_comp(cur_node->value, k)) {
+                    cur_node = cur_node->right;
+                } else {
+                    return (ft::make_pair(lower_bound_node(cur_node->left, cur_node, k),
+                                          upper_bound_node(cur_node->right, res_node, k)));
+                }
+            }
+            return (ft::make_pair(res_node, res_node));
+        }
+
+        template<class Key>
+        iterator lower_bound(const Key &k) {
+            return (iterator(lower_bound_node(this->_root, this->_super_root, k)));
+        }
+
+        template<class Key>
+        const_iterator lower_bound(const Key &k) const {
+            return (const_iterator(lower_bound_node(this->_root, this->_super_root, k)));
+        }
+
+        template<class Key>
+        iterator upper_bound(const Key &k) {
+            return (iterator(upper_bound_node(this->_root, this->_super_root, k)));
+        }
+
+        template<class Key>
+        const_iterator upper_bound(const Key &k) const {
+            return (const_iterator(upper_bound_node(this->_root, this->_super_root, k)));
         }
 
-        pair<iterator, iterator> equal_range(const value_type &v) {
-            return (ft::make_pair(this->lower_bound(v), this->upper_bound(v)));
+        template<class Key>
+        pair<iterator, iterator> equal_range(const Key &k) {
+            pair<node_pointer, node_pointer> res = equal_range_node(k);
+            return (ft::make_pair(iterator(res.first), iterator(res.second)));
         }
 
-        pair<const_iterator, const_iterator> equal_range(const value_type &v) const {
-            return (ft::make_pair(this->lower_bound(v), this->upper_bound(v)));
+        template<class Key>
+        pair<const_iterator, const_iterator> equal_range(const Key &k) const {
+            pair<node_pointer, node_pointer> res = equal_range_node(k);
+            return (ft::make_pair(const_iterator(res.first), const_iterator(res.second)));
         }
     };
 
-    template<class Content, class Compare, class Alloc>
-    bool operator<(const tree<Content, Compare, Alloc> &lhs, const tree<Content, Compare, Alloc> &rhs) {
+    template<class Content, class Compare, class Alloc, class Update>
+    bool operator<(const tree<Content, Compare, Alloc, Update> &lhs, const tree<Content, Compare, Alloc, Update> &rhs) {
         return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
     }
 
-    template<class Content, class Compare, class Alloc>
-    bool operator>(const tree<Content, Compare, Alloc> &lhs, const tree<Content, Compare, Alloc> &rhs) {
+    template<class Content, class Compare, class Alloc, class Update>
+    bool operator>(const tree<Content, Compare, Alloc, Update> &lhs, const tree<Content, Compare, Alloc, Update> &rhs) {
         return (lhs < rhs);
     }
 
 
-    template<class Content, class Compare, class Alloc>
-    bool operator==(const tree<Content, Compare, Alloc> &lhs, const tree<Content, Compare, Alloc> &rhs) {
+    template<class Content, class Compare, class Alloc, class Update>
+    bool operator==(const tree<Content, Compare, Alloc, Update> &lhs, const tree<Content, Compare, Alloc, Update> &rhs) {
         return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
     }
 
-    template<class Content, class Compare, class Alloc>
-    void swap(const tree<Content, Compare, Alloc> &lhs, const tree<Content, Compare, Alloc> &rhs) {
+    template<class Content, class Compare, class Alloc, class Update>
+    void swap(const tree<Content, Compare, Alloc, Update> &lhs, const tree<Content, Compare, Alloc, Update> &rhs) {
         lhs.swap(rhs);
     }
 }
@@ -4,23 +4,27 @@
 #include <algorithm>
 #include "../util/util.hpp"
 #include "../iterator/iterator_traits.hpp"
+#include "node_update.hpp"
 
 namespace ft {
-    template<class Value>
-    class Node {
+    // No virtual members and a one-byte height (an AVL tree of 2^64 nodes is
+    // under 94 levels tall) keep the per-entry bookkeeping to three pointers.
+    // Meta is the node update policy's metadata; the default one is empty.
+    template<class Value, class Meta = null_node_update::metadata_type>
+    class Node : public Meta {
     public:
         Value value;
         Node *parent;
         Node *left;
         Node *right;
-        int height;
+        unsigned char height;
 
     public:
         explicit Node() : value(), parent(0), left(0), right(0), height(0) {}
 
         explicit Node(Value v) : value(v), parent(0), left(0), right(0), height(1) {}
 
-        Node(Value *value, Node *parent, Node *left, Node *right, int height) {
+        Node(Value *value, Node *parent, Node *left, Node *right, unsigned char height) {
             this->value = value;
             this->parent = parent;
             this->left = left;
@@ -28,23 +32,23 @@ namespace ft {
             this->height = height;
         }
 
-        Node(const Node &copy) {
+        Node(const Node &copy) : Meta(copy) {
             *this = copy;
         }
 
         Node &operator=(const Node &copy) {
             this->value = copy.value;
-            this->parent = parent;
+            this->parent = copy.parent;
             this->left = copy.left;
             this->right = copy.right;
             this->height = copy.height;
             return (*this);
         }
 
-        virtual ~Node() {}
+        ~Node() {}
     };
 
-    template<class T>
+    template<class T, class Meta = null_node_update::metadata_type>
     class tree_iterator {
     public:
         typedef T iterator_type;
@@ -53,7 +57,7 @@ namespace ft {
         typedef typename iterator_traits<iterator_type *>::pointer pointer;
         typedef typename iterator_traits<iterator_type *>::reference reference;
         typedef typename iterator_traits<iterator_type *>::difference_type difference_type;
-        typedef Node<typename std::remove_const<value_type>::type> *node_pointer;
+        typedef Node<typename std::remove_const<value_type>::type, Meta> *node_pointer;
 
     private:
         node_pointer _node_p;
@@ -65,16 +69,16 @@ namespace ft {
             this->_node_p = static_cast<node_pointer>(node_p);
         }
 
-        tree_iterator(const tree_iterator<typename std::remove_const<value_type>::type> &other) {
+        tree_iterator(const tree_iterator<typename std::remove_const<value_type>::type, Meta> &other) {
             *this = other;
         }
 
-        tree_iterator &operator=(const tree_iterator<typename std::remove_const<value_type>::type> &copy) {
+        tree_iterator &operator=(const tree_iterator<typename std::remove_const<value_type>::type, Meta> &copy) {
             this->_node_p = copy.base();
             return (*this);
         }
 
-        virtual ~tree_iterator() {}
+        ~tree_iterator() {}
 
         node_pointer base() const {
             return (this->_node_p);
@@ -126,7 +130,9 @@ namespace ft {
             node_pointer cur_node = this->_node_p;
             node_pointer res_node;
 
-            if (cur_node->left != 0)
+            if (cur_node->parent == 0)
+                this->_node_p = cur_node->right;
+            else if (cur_node->left != 0)
                 this->_node_p = find_max_value(cur_node->left);
             else {
                 res_node = cur_node;
@@ -144,47 +150,17 @@ namespace ft {
         }
     };
 
-    template<typename A, typename B>
-    bool operator==(const tree_iterator<A> &lhs,
-                    const tree_iterator<B> &rhs) {
+    template<typename A, typename B, typename Meta>
+    bool operator==(const tree_iterator<A, Meta> &lhs,
+                    const tree_iterator<B, Meta> &rhs) {
         return (lhs.base() == rhs.base());
     };
 
-    template<typename A, typename B>
-    bool operator!=(const tree_iterator<A> &lhs,
-                    const tree_iterator<B> &rhs) {
+    template<typename A, typename B, typename Meta>
+    bool operator!=(const tree_iterator<A, Meta> &lhs,
+                    const tree_iterator<B, Meta> &rhs) {
         return (!(lhs.base() == rhs.base()));
     };
-
-    template<class T1, class T2>
-    bool operator==(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
-        return lhs.first == rhs.first && lhs.second == rhs.second;
-    };
-
-    template<class T1, class T2>
-    bool operator!=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
-        return !(lhs == rhs);
-    };
-
-    template<class T1, class T2>
-    bool operator<(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
-        return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
-    };
-
-    template<class T1, class T2>
-    bool operator<=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
-        return !(rhs < lhs);
-    };
-
-    template<class T1, class T2>
-    bool operator>(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
-        return rhs < lhs;
-    };
-
-    template<class T1, class T2>
-    bool operator>=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
-        return !(lhs < rhs);
-    };
 }
 
 #endif
\ No newline at end of file
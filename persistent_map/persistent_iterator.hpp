@@ -0,0 +1,157 @@
+#ifndef PERSISTENT_ITERATOR
+#define PERSISTENT_ITERATOR
+
+#include <cstddef>
+#include "../iterator/iterator_traits.hpp"
+
+namespace ft {
+    // Nodes may be shared by several maps, so they carry no parent pointer
+    // and count the parents (and roots) that point at them instead. A node
+    // with refs == 1 reached through nodes with refs == 1 belongs to a single
+    // map and may be changed in place; any other node is copied first.
+    template<class Value>
+    struct persistent_node {
+        typedef Value value_type;
+
+        Value value;
+        persistent_node *left;
+        persistent_node *right;
+        std::size_t refs;
+        unsigned char height;
+
+        explicit persistent_node(const Value &v) : value(v), left(0), right(0), refs(1), height(1) {}
+
+        persistent_node(const persistent_node &copy) :
+                value(copy.value), left(copy.left), right(copy.right), refs(1), height(copy.height) {}
+    };
+
+    // Without parent pointers the iterator keeps the path from the root; an
+    // empty path is end(). Any change to the map it came from invalidates
+    // it, while iterators into a snapshot stay valid as long as the snapshot.
+    template<class Value>
+    class persistent_iterator {
+    public:
+        typedef const Value iterator_type;
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename iterator_traits<iterator_type *>::value_type value_type;
+        typedef typename iterator_traits<iterator_type *>::pointer pointer;
+        typedef typename iterator_traits<iterator_type *>::reference reference;
+        typedef typename iterator_traits<iterator_type *>::difference_type difference_type;
+        typedef const persistent_node<Value> *node_pointer;
+
+        // An AVL tree of 2^64 nodes is under 94 levels tall.
+        enum { max_depth = 96 };
+
+    private:
+        node_pointer _root;
+        node_pointer _path[max_depth];
+        int _depth;
+
+    public:
+        persistent_iterator() : _root(0), _depth(0) {}
+
+        explicit persistent_iterator(node_pointer root) : _root(root), _depth(0) {}
+
+        persistent_iterator(const persistent_iterator &other) {
+            *this = other;
+        }
+
+        persistent_iterator &operator=(const persistent_iterator &copy) {
+            this->_root = copy._root;
+            this->_depth = copy._depth;
+            for (int i = 0; i < copy._depth; i++)
+                this->_path[i] = copy._path[i];
+            return (*this);
+        }
+
+        ~persistent_iterator() {}
+
+        node_pointer base() const {
+            return (this->_depth == 0 ? 0 : this->_path[this->_depth - 1]);
+        }
+
+        int depth() const {
+            return (this->_depth);
+        }
+
+        void push(node_pointer node) {
+            this->_path[this->_depth++] = node;
+        }
+
+        void truncate(int depth) {
+            this->_depth = depth;
+        }
+
+        persistent_iterator &push_leftmost(node_pointer node) {
+            for (; node != 0; node = node->left)
+                push(node);
+            return (*this);
+        }
+
+        persistent_iterator &push_rightmost(node_pointer node) {
+            for (; node != 0; node = node->right)
+                push(node);
+            return (*this);
+        }
+
+        reference operator*() const {
+            return (this->_path[this->_depth - 1]->value);
+        }
+
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        persistent_iterator &operator++() {
+            node_pointer cur_node = this->_path[this->_depth - 1];
+
+            if (cur_node->right != 0)
+                return (push_leftmost(cur_node->right));
+            do {
+                cur_node = this->_path[--this->_depth];
+            } while (this->_depth > 0 && this->_path[this->_depth - 1]->right == cur_node);
+            return (*this);
+        }
+
+        persistent_iterator operator++(int) {
+            persistent_iterator tmp(*this);
+
+            ++(*this);
+            return (tmp);
+        }
+
+        persistent_iterator &operator--() {
+            if (this->_depth == 0)
+                return (push_rightmost(this->_root));
+            node_pointer cur_node = this->_path[this->_depth - 1];
+
+            if (cur_node->left != 0)
+                return (push_rightmost(cur_node->left));
+            do {
+                cur_node = this->_path[--this->_depth];
+            } while (this->_depth > 0 && this->_path[this->_depth - 1]->left == cur_node);
+            return (*this);
+        }
+
+        persistent_iterator operator--(int) {
+            persistent_iterator tmp(*this);
+
+            --(*this);
+            return (tmp);
+        }
+    };
+
+    template<typename Value>
+    bool operator==(const persistent_iterator<Value> &lhs,
+                    const persistent_iterator<Value> &rhs) {
+        return (lhs.base() == rhs.base());
+    }
+
+    template<typename Value>
+    bool operator!=(const persistent_iterator<Value> &lhs,
+                    const persistent_iterator<Value> &rhs) {
+        return (!(lhs == rhs));
+    }
+}
+
+#endif
@@ -0,0 +1,253 @@
+#ifndef PERSISTENT_MAP
+#define PERSISTENT_MAP
+
+#include <functional>
+#include "../util/util.hpp"
+#include "../map/pair_compare.hpp"
+#include "../vector/vector.hpp"
+#include "persistent_tree.hpp"
+
+namespace ft {
+    // A map whose copies are O(1) snapshots: copies share every node and an
+    // update path-copies only the O(log n) nodes it shares with another copy.
+    // Iterators are read-only, since writing through one could reach a
+    // snapshot; values change through operator[], insert_or_assign and
+    // assign. The reference operator[] returns is valid until the map is next
+    // changed or copied.
+    template<class Key, class value, class Compare = std::less<Key>,
+            class Allocator = std::allocator<pair<const Key, value> > >
+    class persistent_map {
+    public:
+        typedef Key key_type;
+        typedef value mapped_type;
+
+        typedef pair<const Key, value> value_type;
+        typedef Compare key_compare;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef std::ptrdiff_t difference_type;
+        typedef std::size_t size_type;
+        typedef ft::pair_compare<value_type, Compare> value_compare;
+        typedef persistent_tree<value_type, value_compare, allocator_type> tree_type;
+        typedef typename tree_type::iterator iterator;
+        typedef typename tree_type::const_iterator const_iterator;
+        typedef typename tree_type::reverse_iterator reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+    private:
+        key_compare _comp;
+        allocator_type _allocator;
+        tree_type _tree;
+
+    public:
+        explicit persistent_map(const key_compare &comp = key_compare(),
+                                const allocator_type &alloc = allocator_type())
+                : _comp(comp), _allocator(alloc), _tree(comp, alloc) {}
+
+        template<class InputIterator>
+        persistent_map(InputIterator first, InputIterator last,
+                       const key_compare &comp = key_compare(),
+                       const allocator_type &alloc = allocator_type())
+                : _comp(comp), _allocator(alloc), _tree(first, last, comp, alloc) {}
+
+        persistent_map(const persistent_map &x) : _comp(x._comp), _allocator(x._allocator), _tree(x._tree) {}
+
+        persistent_map &operator=(const persistent_map &x) {
+            if (this != &x) {
+                this->_allocator = x._allocator;
+                this->_comp = x._comp;
+                this->_tree = x._tree;
+            }
+            return (*this);
+        }
+
+        ~persistent_map() {}
+
+        persistent_map snapshot() const {
+            return (*this);
+        }
+
+        bool shares_root(const persistent_map &other) const {
+            return (this->_tree.shares_root(other._tree));
+        }
+
+        const_iterator begin() const {
+            return (this->_tree.begin());
+        }
+
+        const_iterator end() const {
+            return (this->_tree.end());
+        }
+
+        const_reverse_iterator rbegin() const {
+            return (this->_tree.rbegin());
+        }
+
+        const_reverse_iterator rend() const {
+            return (this->_tree.rend());
+        }
+
+        bool empty() const {
+            return (this->_tree.empty());
+        }
+
+        size_type size() const {
+            return (this->_tree.size());
+        }
+
+        size_type max_size() const {
+            return (this->_tree.max_size());
+        }
+
+        mapped_type &operator[](const key_type &k) {
+            value_type *val = this->_tree.unshare(k);
+
+            if (val == 0) {
+                this->_tree.try_emplace(k);
+                val = this->_tree.unshare(k);
+            }
+            return (val->second);
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k) {
+            return (this->_tree.try_emplace(k));
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k, const mapped_type &obj) {
+            return (this->_tree.try_emplace(k, obj));
+        }
+
+        pair<iterator, bool> insert_or_assign(const key_type &k, const mapped_type &obj) {
+            if (assign(k, obj))
+                return (pair<iterator, bool>(this->_tree.find(k), false));
+            return (this->_tree.try_emplace(k, obj));
+        }
+
+        // Replaces the value of an existing key; false if k is absent.
+        bool assign(const key_type &k, const mapped_type &obj) {
+            if (this->_tree.count(k) == 0)
+                return (false);
+            this->_tree.unshare(k)->second = obj;
+            return (true);
+        }
+
+        pair<iterator, bool> insert(const value_type &val) {
+            return (this->_tree.insert(val));
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            return (this->_tree.insert(position, val));
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            return (this->_tree.insert(first, last));
+        }
+
+        void erase(iterator position) {
+            this->_tree.erase(position);
+        }
+
+        size_type erase(const key_type &k) {
+            return (this->_tree.erase(k));
+        }
+
+        // Erasing invalidates iterators, so the keys are collected first.
+        void erase(iterator first, iterator last) {
+            if (first == begin() && last == end()) {
+                clear();
+                return;
+            }
+            vector<key_type> keys;
+
+            for (; first != last; ++first)
+                keys.push_back(first->first);
+            for (typename vector<key_type>::size_type i = 0; i < keys.size(); i++)
+                this->_tree.erase(keys[i]);
+        }
+
+        void swap(persistent_map &x) {
+            this->_tree.swap(x._tree);
+            std::swap(this->_comp, x._comp);
+            std::swap(this->_allocator, x._allocator);
+        }
+
+        void clear() {
+            this->_tree.clear();
+        }
+
+        key_compare key_comp() const {
+            return (this->_comp);
+        }
+
+        value_compare value_comp() const {
+            return (this->_tree.value_comp());
+        }
+
+        const_iterator find(const key_type &k) const {
+            return (this->_tree.find(k));
+        }
+
+        size_type count(const key_type &k) const {
+            return (this->_tree.count(k));
+        }
+
+        const_iterator lower_bound(const key_type &k) const {
+            return (this->_tree.lower_bound(k));
+        }
+
+        const_iterator upper_bound(const key_type &k) const {
+            return (this->_tree.upper_bound(k));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const {
+            return (this->_tree.equal_range(k));
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+    };
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator==(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs) {
+        return (lhs.size() == rhs.size() && (lhs.shares_root(rhs) || ft::equal(lhs.begin(), lhs.end(), rhs.begin())));
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator!=(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator<(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs) {
+        return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator>(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs) {
+        return (rhs < lhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator<=(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs) {
+        return !(lhs > rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    bool operator>=(const persistent_map<Key, T, Compare, Alloc> &lhs, const persistent_map<Key, T, Compare, Alloc> &rhs) {
+        return !(lhs < rhs);
+    }
+
+    template<class Key, class T, class Compare, class Alloc>
+    void swap(persistent_map<Key, T, Compare, Alloc> &lhs, persistent_map<Key, T, Compare, Alloc> &rhs) {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
@@ -0,0 +1,440 @@
+#ifndef PERSISTENT_TREE
+#define PERSISTENT_TREE
+
+#include <memory>
+#include <algorithm>
+#include "../util/util.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "persistent_iterator.hpp"
+
+namespace ft {
+    // An AVL tree whose copies share every node. Copying only bumps the root's
+    // count; an update then copies the O(log n) nodes on its path that are
+    // still shared and changes the rest in place, so a map nobody snapshotted
+    // updates without allocating more than the usual node.
+    //
+    // Counts are not atomic: a map and its snapshots belong to one thread.
+    template<class Value, class Compare, class Allocator = std::allocator<Value> >
+    class persistent_tree {
+    public:
+        typedef Value value_type;
+        typedef Compare value_compare;
+
+        typedef persistent_node<Value> node_type;
+        typedef node_type *node_pointer;
+        typedef typename Allocator::template rebind<node_type>::other node_allocator;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef typename allocator_type::size_type size_type;
+
+        typedef persistent_iterator<value_type> iterator;
+        typedef persistent_iterator<value_type> const_iterator;
+
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        value_compare _comp;
+        allocator_type _allocator;
+        node_allocator _node_alloc;
+        node_pointer _root;
+        size_type _size;
+
+    public:
+        persistent_tree() : _comp(value_compare()), _root(0), _size(0) {}
+
+        persistent_tree(const value_compare &comp,
+                        const allocator_type &alloc = allocator_type()) :
+                _comp(comp), _allocator(alloc), _node_alloc(alloc), _root(0), _size(0) {}
+
+        template<class InputIterator>
+        persistent_tree(InputIterator first, InputIterator last,
+                        const value_compare &comp,
+                        const allocator_type &alloc = allocator_type()) :
+                _comp(comp), _allocator(alloc), _node_alloc(alloc), _root(0), _size(0) {
+            insert(first, last);
+        }
+
+        persistent_tree(const persistent_tree &copy) :
+                _comp(copy._comp), _allocator(copy._allocator), _node_alloc(copy._node_alloc), _root(copy._root),
+                _size(copy._size) {
+            retain(this->_root);
+        }
+
+        persistent_tree &operator=(const persistent_tree &copy) {
+            retain(copy._root);
+            release(this->_root);
+            this->_comp = copy._comp;
+            this->_allocator = copy._allocator;
+            this->_node_alloc = copy._node_alloc;
+            this->_root = copy._root;
+            this->_size = copy._size;
+            return (*this);
+        }
+
+        ~persistent_tree() {
+            release(this->_root);
+        }
+
+        const_iterator begin() const {
+            return (const_iterator(this->_root).push_leftmost(this->_root));
+        }
+
+        const_iterator end() const {
+            return (const_iterator(this->_root));
+        }
+
+        const_reverse_iterator rbegin() const {
+            return (const_reverse_iterator(end()));
+        }
+
+        const_reverse_iterator rend() const {
+            return (const_reverse_iterator(begin()));
+        }
+
+        size_type size() const {
+            return (this->_size);
+        }
+
+        bool empty() const {
+            return (this->_size == 0);
+        }
+
+        size_type max_size() const {
+            return (this->_node_alloc.max_size());
+        }
+
+        value_compare value_comp() const {
+            return (this->_comp);
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
+        // True while both trees still share their whole structure.
+        bool shares_root(const persistent_tree &other) const {
+            return (this->_root == other._root);
+        }
+
+        void swap(persistent_tree &x) {
+            std::swap(this->_comp, x._comp);
+            std::swap(this->_allocator, x._allocator);
+            std::swap(this->_node_alloc, x._node_alloc);
+            std::swap(this->_root, x._root);
+            std::swap(this->_size, x._size);
+        }
+
+        void clear() {
+            release(this->_root);
+            this->_root = 0;
+            this->_size = 0;
+        }
+
+        ft::pair<const_iterator, bool> insert(const value_type &val) {
+            if (search(val) != 0)
+                return (ft::pair<const_iterator, bool>(find(val), false));
+            insert_node(this->_root, val);
+            this->_size++;
+            return (ft::pair<const_iterator, bool>(find(val), true));
+        }
+
+        const_iterator insert(const_iterator position, const value_type &val) {
+            (void) position;
+            return (insert(val).first);
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        template<class Key>
+        ft::pair<const_iterator, bool> try_emplace(const Key &k) {
+            if (search(k) != 0)
+                return (ft::pair<const_iterator, bool>(find(k), false));
+            return (insert(value_type(k, typename value_type::second_type())));
+        }
+
+        template<class Key, class Mapped>
+        ft::pair<const_iterator, bool> try_emplace(const Key &k, const Mapped &obj) {
+            if (search(k) != 0)
+                return (ft::pair<const_iterator, bool>(find(k), false));
+            return (insert(value_type(k, obj)));
+        }
+
+        // Copies the shared nodes on the path to k so the returned node is
+        // this tree's alone; writing through it cannot reach a snapshot.
+        template<class Key>
+        value_type *unshare(const Key &k) {
+            node_pointer *slot = &this->_root;
+
+            while (*slot != 0) {
+                make_writable(*slot);
+                if (this->_comp(k, (*slot)->value))
+                    slot = &(*slot)->left;
+                else if (this->_comp((*slot)->value, k))
+                    slot = &(*slot)->right;
+                else
+                    return (&(*slot)->value);
+            }
+            return (0);
+        }
+
+        template<class Key>
+        size_type erase(const Key &k) {
+            if (search(k) == 0)
+                return (0);
+            erase_node(this->_root, k);
+            return (1);
+        }
+
+        void erase(const_iterator position) {
+            erase(*position);
+        }
+
+        template<class Key>
+        const_iterator find(const Key &k) const {
+            const_iterator it = lower_bound(k);
+
+            if (it == end() || this->_comp(k, *it))
+                return (end());
+            return (it);
+        }
+
+        template<class Key>
+        size_type count(const Key &k) const {
+            return (search(k) != 0);
+        }
+
+        template<class Key>
+        const_iterator lower_bound(const Key &k) const {
+            const_iterator it(this->_root);
+            int found = 0;
+
+            for (node_pointer cur_node = this->_root; cur_node != 0;) {
+                it.push(cur_node);
+                if (this->_comp(cur_node->value, k) == false) {
+                    found = it.depth();
+                    cur_node = cur_node->left;
+                } else {
+                    cur_node = cur_node->right;
+                }
+            }
+            it.truncate(found);
+            return (it);
+        }
+
+        template<class Key>
+        const_iterator upper_bound(const Key &k) const {
+            const_iterator it(this->_root);
+            int found = 0;
+
+            for (node_pointer cur_node = this->_root; cur_node != 0;) {
+                it.push(cur_node);
+                if (this->_comp(k, cur_node->value)) {
+                    found = it.depth();
+                    cur_node = cur_node->left;
+                } else {
+                    cur_node = cur_node->right;
+                }
+            }
+            it.truncate(found);
+            return (it);
+        }
+
+        template<class Key>
+        ft::pair<const_iterator, const_iterator> equal_range(const Key &k) const {
+            return (ft::pair<const_iterator, const_iterator>(lower_bound(k), upper_bound(k)));
+        }
+
+    private:
+        template<class Key>
+        node_pointer search(const Key &k) const {
+            node_pointer cur_node = this->_root;
+
+            while (cur_node != 0) {
+                if (this->_comp(k, cur_node->value))
+                    cur_node = cur_node->left;
+                else if (this->_comp(cur_node->value, k))
+                    cur_node = cur_node->right;
+                else
+                    return (cur_node);
+            }
+            return (0);
+        }
+
+        static void retain(node_pointer node) {
+            if (node != 0)
+                node->refs++;
+        }
+
+        void release(node_pointer node) {
+            while (node != 0 && --node->refs == 0) {
+                node_pointer right = node->right;
+
+                release(node->left);
+                this->_node_alloc.destroy(node);
+                this->_node_alloc.deallocate(node, 1);
+                node = right;
+            }
+        }
+
+        node_pointer create_node(const node_type &src) {
+            node_pointer new_node = this->_node_alloc.allocate(1);
+
+            try {
+                this->_node_alloc.construct(new_node, src);
+            }
+            catch (...) {
+                this->_node_alloc.deallocate(new_node, 1);
+                throw;
+            }
+            return (new_node);
+        }
+
+        // The slot is swapped for a private copy only once the copy exists,
+        // so a throwing copy leaves the tree as it was.
+        void make_writable(node_pointer &slot) {
+            if (slot->refs == 1)
+                return;
+            node_pointer copy = create_node(*slot);
+
+            retain(copy->left);
+            retain(copy->right);
+            slot->refs--;
+            slot = copy;
+        }
+
+        // Rotations on the way back up only touch nodes on the insertion
+        // path, which are already writable, so nothing can throw after the
+        // new node is linked.
+        void insert_node(node_pointer &slot, const value_type &val) {
+            if (slot == 0) {
+                slot = create_node(node_type(val));
+                return;
+            }
+            make_writable(slot);
+            if (this->_comp(val, slot->value))
+                insert_node(slot->left, val);
+            else
+                insert_node(slot->right, val);
+            rebalance(slot);
+        }
+
+        // The node is unlinked rather than overwritten: a two-child node is
+        // replaced by its detached successor, since keys are const. Copies
+        // made while rebalancing can still throw after the unlink; the tree
+        // then stays a valid, slightly unbalanced search tree.
+        template<class Key>
+        void erase_node(node_pointer &slot, const Key &k) {
+            make_writable(slot);
+            node_pointer cur_node = slot;
+
+            if (this->_comp(k, cur_node->value)) {
+                erase_node(cur_node->left, k);
+            } else if (this->_comp(cur_node->value, k)) {
+                erase_node(cur_node->right, k);
+            } else if (cur_node->left != 0 && cur_node->right != 0) {
+                node_pointer successor = detach_min(cur_node->right);
+
+                successor->left = cur_node->left;
+                successor->right = cur_node->right;
+                cur_node->left = 0;
+                cur_node->right = 0;
+                slot = successor;
+                release(cur_node);
+                this->_size--;
+            } else {
+                slot = cur_node->left != 0 ? cur_node->left : cur_node->right;
+                cur_node->left = 0;
+                cur_node->right = 0;
+                release(cur_node);
+                this->_size--;
+                return;
+            }
+            rebalance(slot);
+        }
+
+        node_pointer detach_min(node_pointer &slot) {
+            make_writable(slot);
+            if (slot->left != 0) {
+                node_pointer min = detach_min(slot->left);
+
+                rebalance(slot);
+                return (min);
+            }
+            node_pointer min = slot;
+
+            slot = min->right;
+            min->right = 0;
+            return (min);
+        }
+
+        static int height(node_pointer node) {
+            return (node == 0 ? 0 : node->height);
+        }
+
+        static int get_height_diff(node_pointer node) {
+            return (height(node->left) - height(node->right));
+        }
+
+        static void update_node(node_pointer node) {
+            node->height = static_cast<unsigned char>(std::max(height(node->left), height(node->right)) + 1);
+        }
+
+        // After an erase the taller side can be a shared subtree, so its top
+        // nodes are copied before they rotate.
+        void rebalance(node_pointer &slot) {
+            int h_diff = get_height_diff(slot);
+
+            if (h_diff > 1) {
+                make_writable(slot->left);
+                if (get_height_diff(slot->left) < 0) {
+                    make_writable(slot->left->right);
+                    rotateRR(slot->left);
+                }
+                rotateLL(slot);
+            } else if (h_diff < -1) {
+                make_writable(slot->right);
+                if (get_height_diff(slot->right) > 0) {
+                    make_writable(slot->right->left);
+                    rotateLL(slot->right);
+                }
+                rotateRR(slot);
+            } else {
+                update_node(slot);
+            }
+        }
+
+        static void rotateLL(node_pointer &slot) {
+            node_pointer p_node = slot;
+            node_pointer c_node = p_node->left;
+
+            p_node->left = c_node->right;
+            c_node->right = p_node;
+            update_node(p_node);
+            update_node(c_node);
+            slot = c_node;
+        }
+
+        static void rotateRR(node_pointer &slot) {
+            node_pointer p_node = slot;
+            node_pointer c_node = p_node->right;
+
+            p_node->right = c_node->left;
+            c_node->left = p_node;
+            update_node(p_node);
+            update_node(c_node);
+            slot = c_node;
+        }
+    };
+}
+
+#endif
@@ -27,6 +27,17 @@ namespace ft {
             this->c = other.c;
             return (*this);
         }
+#if FT_HAS_MOVE
+
+        explicit stack(container_type &&cont) : c(std::move(cont)) {}
+
+        stack(stack &&other) : c(std::move(other.c)) {}
+
+        stack &operator=(stack &&other) {
+            this->c = std::move(other.c);
+            return (*this);
+        }
+#endif
 
         bool empty() const {
             return (this->c.empty());
@@ -47,38 +58,43 @@ namespace ft {
         void push(const value_type &val) {
             this->c.push_back(val);
         }
+#if FT_HAS_MOVE
+
+        void push(value_type &&val) {
+            this->c.push_back(std::move(val));
+        }
+
+        template<class... Args>
+        void emplace(Args &&... args) {
+            this->c.emplace_back(std::forward<Args>(args)...);
+        }
+#endif
 
         void pop() {
             this->c.pop_back();
         }
 
-        template<class A, class Cont>
-        friend bool operator==(const stack<A, Cont> &lhs, const stack<A, Cont> &rhs) {
+        friend bool operator==(const stack &lhs, const stack &rhs) {
             return (lhs.c == rhs.c);
         }
 
-        template<class A, class Cont>
-        friend bool operator!=(const stack<A, Cont> &lhs, const stack<A, Cont> &rhs) {
+        friend bool operator!=(const stack &lhs, const stack &rhs) {
             return (lhs.c != rhs.c);
         }
 
-        template<class A, class Cont>
-        friend bool operator<(const stack<A, Cont> &lhs, const stack<A, Cont> &rhs) {
+        friend bool operator<(const stack &lhs, const stack &rhs) {
             return (lhs.c < rhs.c);
         }
 
-        template<class A, class Cont>
-        friend bool operator<=(const stack<A, Cont> &lhs, const stack<A, Cont> &rhs) {
+        friend bool operator<=(const stack &lhs, const stack &rhs) {
             return (lhs.c <= rhs.c);
         }
 
-        template<class A, class Cont>
-        friend bool operator>(const stack<A, Cont> &lhs, const stack<A, Cont> &rhs) {
+        friend bool operator>(const stack &lhs, const stack &rhs) {
             return (lhs.c > rhs.c);
         }
 
-        template<class A, class Cont>
-        friend bool operator>=(const stack<A, Cont> &lhs, const stack<A, Cont> &rhs) {
+        friend bool operator>=(const stack &lhs, const stack &rhs) {
             return (lhs.c >= rhs.c);
         }
     };
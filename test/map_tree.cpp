@@ -0,0 +1,331 @@
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../map/map.hpp"
+#include "../allocator/pool_allocator.hpp"
+
+// usage: ./test/map_tree
+// Regression tests for the tree behind ft::map. Prints the first failed
+// check and returns 1.
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << "Error: " << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+            return (false); \
+        } \
+    } while (0)
+
+typedef ft::map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > > pool_map;
+
+bool check_odd_keys(pool_map &m) {
+    CHECK(m.size() == 32);
+    CHECK(m.end().base()->parent == 0);
+    CHECK((--m.end())->first == 63);
+    CHECK(m.rbegin()->first == 63);
+    int expected = 63;
+    for (pool_map::reverse_iterator it = m.rbegin(); it != m.rend(); ++it, expected -= 2)
+        CHECK(it->first == expected);
+    CHECK(expected == -1);
+    return (true);
+}
+
+// A map built on another's allocator takes its sentinel from the shared
+// free list, out of a node that used to have a parent; --end() must still
+// find the rightmost node, there and in a copy of that map.
+bool end_of_copy_on_reused_memory() {
+    pool_map m;
+
+    for (int i = 0; i < 64; i++)
+        m[i] = i;
+    for (int i = 0; i < 64; i += 2)
+        m.erase(i);
+    pool_map reused(std::less<int>(), m.get_allocator());
+    reused.insert(m.begin(), m.end());
+    pool_map copy(reused);
+
+    if (!check_odd_keys(m) || !check_odd_keys(reused) || !check_odd_keys(copy))
+        return (false);
+
+    pool_map empty_copy((pool_map(std::less<int>(), m.get_allocator())));
+    CHECK(empty_copy.end().base()->parent == 0);
+    empty_copy.insert(ft::make_pair(5, 5));
+    CHECK((--empty_copy.end())->first == 5);
+    return (true);
+}
+
+// Copying one throws once the budget runs out; live counts the instances.
+struct thrower {
+    static int live;
+    static int budget;
+    int v;
+
+    thrower(int x = 0) : v(x) {
+        live++;
+    }
+
+    thrower(const thrower &copy) : v(copy.v) {
+        if (budget == 0)
+            throw 1;
+        if (budget > 0)
+            budget--;
+        live++;
+    }
+
+    thrower &operator=(const thrower &copy) {
+        this->v = copy.v;
+        return (*this);
+    }
+
+    ~thrower() {
+        live--;
+    }
+};
+
+int thrower::live = 0;
+int thrower::budget = -1;
+
+typedef ft::map<int, thrower> thrower_map;
+
+// A copy that throws partway must free every node it built or reused and
+// leave the target empty but usable. The sentinel holds a value too, so
+// every map owns one thrower even when empty.
+bool copy_assign_that_throws() {
+    const int fail_at[] = {0, 1, 10, 29, 30, 31, 60, 99};
+    thrower_map src;
+
+    for (int i = 0; i < 100; i++)
+        src.insert(ft::make_pair(i, thrower(i)));
+    const int src_live = thrower::live;
+    for (unsigned int i = 0; i < sizeof(fail_at) / sizeof(fail_at[0]); i++) {
+        thrower_map dst;
+
+        for (int j = 0; j < 30; j++)
+            dst.insert(ft::make_pair(j * 3, thrower(j)));
+        thrower::budget = fail_at[i];
+        try {
+            dst = src;
+            CHECK(false);
+        } catch (int) {
+        }
+        thrower::budget = -1;
+        CHECK(thrower::live == src_live + 1);
+        CHECK(dst.empty() && dst.begin() == dst.end());
+        dst = src;
+        CHECK(dst.size() == 100 && (--dst.end())->first == 99 && dst[42].v == 42);
+
+        thrower::budget = fail_at[i];
+        try {
+            thrower_map copy(src);
+            CHECK(false);
+        } catch (int) {
+        }
+        thrower::budget = -1;
+        CHECK(thrower::live == src_live + 101);
+    }
+    return (true);
+}
+
+// Building from a sorted range links the new nodes in only once they are all
+// built, so a copy that throws partway must free the part already built.
+bool range_insert_that_throws() {
+    const int fail_at[] = {0, 1, 31, 32, 50, 63, 99};
+    thrower_map src;
+
+    for (int i = 0; i < 100; i++)
+        src.insert(ft::make_pair(i, thrower(i)));
+    const int src_live = thrower::live;
+    for (unsigned int i = 0; i < sizeof(fail_at) / sizeof(fail_at[0]); i++) {
+        thrower_map dst;
+
+        thrower::budget = fail_at[i];
+        try {
+            dst.insert(src.begin(), src.end());
+            CHECK(false);
+        } catch (int) {
+        }
+        thrower::budget = -1;
+        CHECK(thrower::live == src_live + 1);
+        CHECK(dst.empty() && dst.begin() == dst.end());
+        dst.insert(src.begin(), src.end());
+        CHECK(dst.size() == 100 && (--dst.end())->first == 99 && dst[42].v == 42);
+
+        thrower::budget = fail_at[i];
+        try {
+            thrower_map built(src.begin(), src.end());
+            CHECK(false);
+        } catch (int) {
+        }
+        thrower::budget = -1;
+        CHECK(thrower::live == src_live + 101);
+    }
+    return (true);
+}
+
+// Splits and joins a map of 0..n-1 at k and checks every size against a
+// count of the elements, with and without subtree sizes to read them from.
+template<class Map>
+bool split_sizes(int n, int k) {
+    Map m;
+    Map right;
+
+    for (int i = 0; i < n; i++)
+        m[i] = i;
+    m.split(k, right);
+    int left_size = k < 0 ? 0 : (k > n ? n : k);
+    m.erase(0);
+    right[n + 1] = 0;
+    CHECK(m.size() == static_cast<std::size_t>(left_size - (left_size > 0)));
+    CHECK(right.size() == static_cast<std::size_t>(n - left_size + 1));
+    CHECK(m.empty() == (left_size <= 1) && right.empty() == false);
+    m.join(right);
+    CHECK(right.size() == 0 && right.empty());
+    CHECK(m.size() == static_cast<std::size_t>(n - (left_size > 0) + 1));
+    CHECK(static_cast<std::size_t>(std::distance(m.begin(), m.end())) == m.size());
+    Map copy(m);
+    m.split(n / 2, right);
+    copy = m;
+    CHECK(copy.size() == m.size() && copy == m);
+    return (true);
+}
+
+bool split_sizes() {
+    typedef ft::map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >,
+            ft::tree_order_statistics> os_map;
+    const int cuts[] = {-1, 0, 1, 17, 50, 99, 100, 101};
+
+    for (std::size_t i = 0; i < sizeof(cuts) / sizeof(cuts[0]); i++) {
+        if (!split_sizes<ft::map<int, int> >(100, cuts[i]) || !split_sizes<os_map>(100, cuts[i]))
+            return (false);
+    }
+    return (true);
+}
+
+// Runs the set operations on maps of a few hundred keys against ones of a
+// few, both ways round, so both the probe and the merge paths run, and
+// compares each result with std::set_union and friends.
+typedef ft::map<int, int> int_map;
+
+int_map spread(int count, int step, int offset) {
+    int_map m;
+
+    for (int i = 0; i < count; i++)
+        m[i * step + offset] = i * step + offset;
+    return (m);
+}
+
+bool same_keys(const int_map &m, const std::vector<int> &expected) {
+    CHECK(m.size() == expected.size());
+    std::size_t i = 0;
+    for (int_map::const_iterator it = m.begin(); it != m.end(); ++it, ++i)
+        CHECK(it->first == expected[i] && it->second == expected[i]);
+    return (true);
+}
+
+bool set_ops() {
+    const int shapes[][3] = {{500, 1, 0}, {500, 3, 1}, {4, 97, 2}, {4, 100, 0}, {1, 1, 250}, {0, 1, 0}};
+    const std::size_t count = sizeof(shapes) / sizeof(shapes[0]);
+
+    for (std::size_t i = 0; i < count; i++) {
+        for (std::size_t j = 0; j < count; j++) {
+            int_map a = spread(shapes[i][0], shapes[i][1], shapes[i][2]);
+            int_map b = spread(shapes[j][0], shapes[j][1], shapes[j][2]);
+            std::vector<int> ka;
+            std::vector<int> kb;
+            std::vector<int> expected;
+
+            for (int_map::iterator it = a.begin(); it != a.end(); ++it)
+                ka.push_back(it->first);
+            for (int_map::iterator it = b.begin(); it != b.end(); ++it)
+                kb.push_back(it->first);
+
+            int_map res = a;
+            res.set_union(b);
+            std::set_union(ka.begin(), ka.end(), kb.begin(), kb.end(), std::back_inserter(expected));
+            CHECK(same_keys(res, expected));
+
+            res = a;
+            expected.clear();
+            res.set_intersection(b);
+            std::set_intersection(ka.begin(), ka.end(), kb.begin(), kb.end(), std::back_inserter(expected));
+            CHECK(same_keys(res, expected));
+
+            res = a;
+            expected.clear();
+            res.set_difference(b);
+            std::set_difference(ka.begin(), ka.end(), kb.begin(), kb.end(), std::back_inserter(expected));
+            CHECK(same_keys(res, expected));
+        }
+    }
+    return (true);
+}
+
+// Concatenation: associative but not commutative, so a fold taken out of
+// key order shows up.
+struct concat {
+    typedef std::string result_type;
+
+    std::string operator()(const std::string &a, const std::string &b) const {
+        return (a + b);
+    }
+};
+
+// The folds the maps should agree with: their mapped values from
+// lower_bound(lo) up to lower_bound(hi).
+template<class Map>
+typename Map::mapped_type brute_force(const Map &m, int lo, int hi,
+                                      typename Map::mapped_type (*combine)(const typename Map::mapped_type &,
+                                                                           const typename Map::mapped_type &)) {
+    typename Map::mapped_type res = typename Map::mapped_type();
+
+    if (lo >= hi)
+        return (res);
+    for (typename Map::const_iterator it = m.lower_bound(lo); it != m.lower_bound(hi); ++it)
+        res = combine(res, it->second);
+    return (res);
+}
+
+long add(const long &a, const long &b) {
+    return (a + b);
+}
+
+std::string append(const std::string &a, const std::string &b) {
+    return (a + b);
+}
+
+bool aggregate() {
+    typedef ft::map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+            ft::tree_aggregate<std::plus<long> > > sum_map;
+    typedef ft::map<int, std::string, std::less<int>, std::allocator<ft::pair<const int, std::string> >,
+            ft::tree_aggregate<concat> > concat_map;
+    sum_map sums;
+    concat_map words;
+
+    for (int i = 0; i < 200; i += 2) {
+        sums[i] = i * 3 + 1;
+        words.insert(ft::make_pair(i, std::string(1, static_cast<char>('a' + i % 26))));
+    }
+    sums.insert_or_assign(40, 1000);
+    words.insert_or_assign(40, "XY");
+    sums.erase(100);
+    words.erase(100);
+    for (int lo = -3; lo < 204; lo += 7) {
+        for (int hi = -5; hi < 206; hi += 11) {
+            CHECK(sums.aggregate(lo, hi) == brute_force(sums, lo, hi, add));
+            CHECK(words.aggregate(lo, hi) == brute_force(words, lo, hi, append));
+        }
+        CHECK(sums.aggregate(lo, lo) == 0 && words.aggregate(lo, lo).empty());
+        CHECK(sums.aggregate(lo + 10, lo) == 0 && words.aggregate(lo + 10, lo).empty());
+    }
+    CHECK(sums.aggregate(0, 4) == 1 + 7 && sums.aggregate(0, 5) == 1 + 7 + 13);
+    return (true);
+}
+
+int main() {
+    if (!end_of_copy_on_reused_memory() || !copy_assign_that_throws() || !range_insert_that_throws()
+        || !split_sizes() || !set_ops() || !aggregate())
+        return (1);
+    std::cout << "map_tree: ok" << std::endl;
+    return (0);
+}
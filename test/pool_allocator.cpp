@@ -0,0 +1,92 @@
+#include <iostream>
+#include "../map/map.hpp"
+#include "../allocator/pool_allocator.hpp"
+
+// usage: ./test/pool_allocator
+// Checks pool_allocator's sharing rules and slot alignment. Prints the
+// first failed check and returns 1.
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << "Error: " << __FILE__ << ":" << __LINE__ << ": " << #cond << std::endl; \
+            return (false); \
+        } \
+    } while (0)
+
+typedef ft::pair<const int, int> value_type;
+typedef ft::map<int, int, std::less<int>, ft::pool_allocator<value_type> > pool_map;
+typedef pool_map::tree_type::node_type node_type;
+
+struct wide {
+    char c;
+    long double x;
+};
+
+// A(B(a)) == a, and memory freed through one copy is handed out again by
+// another, rebound ones included.
+bool rebind_shares_the_arena() {
+    ft::pool_allocator<int> a;
+    ft::pool_allocator<double> b(a);
+    ft::pool_allocator<int> back(b);
+
+    CHECK(b == a && back == a && ft::pool_allocator<int>() != a);
+
+    int *p = a.allocate(1);
+    back.deallocate(p, 1);
+    CHECK(a.allocate(1) == p);
+    a.deallocate(p, 1);
+    return (true);
+}
+
+// The allocator a map hands out reaches the pool its nodes live in, but a
+// copy of the map gets an arena of its own.
+bool map_allocators() {
+    pool_map m;
+
+    for (int i = 0; i < 100; i++)
+        m[i] = i;
+    CHECK(m.get_allocator() == m.get_allocator());
+
+    ft::pool_allocator<node_type> nodes(m.get_allocator());
+    node_type *freed = m.find(42).base();
+    m.erase(42);
+    node_type *p = nodes.allocate(1);
+    CHECK(p == freed);
+    nodes.deallocate(p, 1);
+
+    pool_map copy(m);
+    CHECK(copy.get_allocator() != m.get_allocator());
+    CHECK(copy.size() == 99 && copy[7] == 7);
+    pool_map assigned;
+    assigned = m;
+    CHECK(assigned.get_allocator() != m.get_allocator() && assigned.size() == 99);
+    return (true);
+}
+
+// Slots are aligned for their type even when it is wider than a pointer.
+bool slots_are_aligned() {
+    struct probe {
+        char c;
+        wide w;
+    };
+    const std::size_t align = sizeof(probe) - sizeof(wide);
+    ft::pool_allocator<wide> a;
+    ft::pool_allocator<char> bytes(a);
+    wide *slots[100];
+
+    for (int i = 0; i < 100; i++) {
+        bytes.allocate(1);
+        slots[i] = a.allocate(1);
+        CHECK(reinterpret_cast<std::size_t>(slots[i]) % align == 0);
+    }
+    for (int i = 0; i < 100; i++)
+        a.deallocate(slots[i], 1);
+    return (true);
+}
+
+int main() {
+    if (!rebind_shares_the_arena() || !map_allocators() || !slots_are_aligned())
+        return (1);
+    std::cout << "pool_allocator: ok" << std::endl;
+    return (0);
+}
@@ -0,0 +1,114 @@
+#ifndef HASH
+#define HASH
+
+#include <cstddef>
+#include <string>
+
+namespace ft {
+    // The table mixes every hash before splitting it into a group index and
+    // a control byte, so these only have to be injective, not well spread.
+    template<class T>
+    struct hash {
+    };
+
+    template<class T>
+    struct hash<T *> {
+        std::size_t operator()(T *p) const {
+            return (reinterpret_cast<std::size_t>(p));
+        }
+    };
+
+    template<class T>
+    struct integral_hash {
+        std::size_t operator()(T v) const {
+            return (static_cast<std::size_t>(v));
+        }
+    };
+
+    template<>
+    struct hash<bool> : public integral_hash<bool> {
+    };
+
+    template<>
+    struct hash<char> : public integral_hash<char> {
+    };
+
+    template<>
+    struct hash<wchar_t> : public integral_hash<wchar_t> {
+    };
+
+    template<>
+    struct hash<signed char> : public integral_hash<signed char> {
+    };
+
+    template<>
+    struct hash<short int> : public integral_hash<short int> {
+    };
+
+    template<>
+    struct hash<int> : public integral_hash<int> {
+    };
+
+    template<>
+    struct hash<long int> : public integral_hash<long int> {
+    };
+
+    template<>
+    struct hash<long long int> : public integral_hash<long long int> {
+    };
+
+    template<>
+    struct hash<unsigned char> : public integral_hash<unsigned char> {
+    };
+
+    template<>
+    struct hash<unsigned short int> : public integral_hash<unsigned short int> {
+    };
+
+    template<>
+    struct hash<unsigned int> : public integral_hash<unsigned int> {
+    };
+
+    template<>
+    struct hash<unsigned long int> : public integral_hash<unsigned long int> {
+    };
+
+    template<>
+    struct hash<unsigned long long int> : public integral_hash<unsigned long long int> {
+    };
+
+    // FNV-1a.
+    template<>
+    struct hash<std::string> {
+        std::size_t operator()(const std::string &s) const {
+            std::size_t h = static_cast<std::size_t>(2166136261u);
+
+            for (std::size_t i = 0; i < s.size(); i++) {
+                h ^= static_cast<unsigned char>(s[i]);
+                h *= static_cast<std::size_t>(16777619u);
+            }
+            return (h);
+        }
+    };
+
+    inline std::size_t hash_mix(std::size_t h) {
+        if (sizeof(std::size_t) >= 8) {
+            unsigned long long x = h;
+
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 33;
+            x *= 0xc4ceb9fe1a85ec53ULL;
+            x ^= x >> 33;
+            return (static_cast<std::size_t>(x));
+        }
+        h ^= h >> 16;
+        h *= static_cast<std::size_t>(0x85ebca6bu);
+        h ^= h >> 13;
+        h *= static_cast<std::size_t>(0xc2b2ae35u);
+        h ^= h >> 16;
+        return (h);
+    }
+}
+
+#endif
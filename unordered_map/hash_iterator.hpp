@@ -0,0 +1,178 @@
+#ifndef HASH_ITERATOR
+#define HASH_ITERATOR
+
+#include <cstddef>
+#include "../iterator/iterator_traits.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ft {
+    // One control byte per slot. Full slots store the low seven bits of the
+    // mixed hash, so every special state has the sign bit set and sorts below
+    // hash_sentinel, which terminates iteration one byte past the last slot.
+    enum {
+        hash_empty = -128,
+        hash_deleted = -2,
+        hash_sentinel = -1,
+        hash_group_width = 16
+    };
+
+    // Sixteen control bytes compared at once; each match is one bit of the
+    // returned mask, slot i of the group being bit i.
+    struct hash_group {
+#if defined(__SSE2__)
+        __m128i ctrl;
+
+        explicit hash_group(const signed char *p) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))) {}
+
+        unsigned int match(signed char h2) const {
+            return (static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->ctrl))));
+        }
+
+        unsigned int match_empty() const {
+            return (match(static_cast<signed char>(hash_empty)));
+        }
+
+        unsigned int match_empty_or_deleted() const {
+            return (static_cast<unsigned int>(_mm_movemask_epi8(
+                    _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<signed char>(hash_sentinel)), this->ctrl))));
+        }
+#else
+        const signed char *ctrl;
+
+        explicit hash_group(const signed char *p) : ctrl(p) {}
+
+        unsigned int match(signed char h2) const {
+            unsigned int mask = 0;
+
+            for (int i = 0; i < hash_group_width; i++)
+                if (this->ctrl[i] == h2)
+                    mask |= 1u << i;
+            return (mask);
+        }
+
+        unsigned int match_empty() const {
+            return (match(static_cast<signed char>(hash_empty)));
+        }
+
+        unsigned int match_empty_or_deleted() const {
+            unsigned int mask = 0;
+
+            for (int i = 0; i < hash_group_width; i++)
+                if (this->ctrl[i] < hash_sentinel)
+                    mask |= 1u << i;
+            return (mask);
+        }
+#endif
+    };
+
+    inline int hash_lowest_bit(unsigned int mask) {
+#if defined(__GNUC__)
+        return (__builtin_ctz(mask));
+#else
+        int i = 0;
+
+        while ((mask & 1u) == 0) {
+            mask >>= 1;
+            i++;
+        }
+        return (i);
+#endif
+    }
+
+    // Control bytes of a table with no slots: begin() == end() without a
+    // branch, and lookups stop at the capacity check before touching it.
+    template<class Dummy>
+    struct hash_empty_ctrl {
+        static const signed char bytes[1];
+    };
+
+    template<class Dummy>
+    const signed char hash_empty_ctrl<Dummy>::bytes[1] = {hash_sentinel};
+
+    template<class T, class Value>
+    class hash_iterator {
+    public:
+        typedef T iterator_type;
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename iterator_traits<iterator_type *>::value_type value_type;
+        typedef typename iterator_traits<iterator_type *>::pointer pointer;
+        typedef typename iterator_traits<iterator_type *>::reference reference;
+        typedef typename iterator_traits<iterator_type *>::difference_type difference_type;
+        typedef Value *slot_pointer;
+
+    private:
+        const signed char *_ctrl;
+        slot_pointer _slot;
+
+    public:
+        hash_iterator() : _ctrl(0), _slot(0) {}
+
+        hash_iterator(const signed char *ctrl, slot_pointer slot) : _ctrl(ctrl), _slot(slot) {}
+
+        hash_iterator(const hash_iterator<Value, Value> &other) {
+            *this = other;
+        }
+
+        hash_iterator &operator=(const hash_iterator<Value, Value> &copy) {
+            this->_ctrl = copy.ctrl();
+            this->_slot = copy.base();
+            return (*this);
+        }
+
+        ~hash_iterator() {}
+
+        slot_pointer base() const {
+            return (this->_slot);
+        }
+
+        const signed char *ctrl() const {
+            return (this->_ctrl);
+        }
+
+        reference operator*() const {
+            return (*this->_slot);
+        }
+
+        pointer operator->() const {
+            return &(operator*());
+        }
+
+        hash_iterator &operator++() {
+            ++this->_ctrl;
+            ++this->_slot;
+            return (skip_free());
+        }
+
+        hash_iterator operator++(int) {
+            hash_iterator tmp(*this);
+
+            ++(*this);
+            return (tmp);
+        }
+
+        hash_iterator &skip_free() {
+            while (*this->_ctrl < hash_sentinel) {
+                ++this->_ctrl;
+                ++this->_slot;
+            }
+            return (*this);
+        }
+    };
+
+    template<typename A, typename B, typename Value>
+    bool operator==(const hash_iterator<A, Value> &lhs,
+                    const hash_iterator<B, Value> &rhs) {
+        return (lhs.ctrl() == rhs.ctrl());
+    }
+
+    template<typename A, typename B, typename Value>
+    bool operator!=(const hash_iterator<A, Value> &lhs,
+                    const hash_iterator<B, Value> &rhs) {
+        return (!(lhs == rhs));
+    }
+}
+
+#endif
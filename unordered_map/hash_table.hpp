@@ -0,0 +1,470 @@
+#ifndef HASH_TABLE
+#define HASH_TABLE
+
+#include <memory>
+#include <cstring>
+#include <algorithm>
+#include "../util/util.hpp"
+#include "hash.hpp"
+#include "hash_iterator.hpp"
+
+namespace ft {
+    // Open addressing over groups of sixteen slots. A probe visits whole
+    // groups in triangular order, checks every control byte of a group with
+    // one SSE2 compare, and stops at the first group holding an empty slot.
+    // Erase leaves a tombstone only when its group is already full, since a
+    // group with an empty slot was never passed over by any probe.
+    //
+    // Hasher and KeyEqual take a stored value on the left and either a value
+    // or a key on the right, the same way map's pair_compare does.
+    template<class Value, class Hasher, class KeyEqual, class Allocator = std::allocator<Value> >
+    class hash_table {
+    public:
+        typedef Value value_type;
+        typedef Hasher hasher;
+        typedef KeyEqual key_equal;
+
+        typedef typename Allocator::template rebind<signed char>::other ctrl_allocator;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef typename allocator_type::size_type size_type;
+
+        typedef hash_iterator<value_type, value_type> iterator;
+        typedef hash_iterator<const value_type, value_type> const_iterator;
+
+    private:
+        hasher _hash;
+        key_equal _eq;
+        allocator_type _allocator;
+        ctrl_allocator _ctrl_alloc;
+        signed char *_ctrl;
+        value_type *_slots;
+        size_type _capacity;
+        size_type _size;
+        size_type _tombstones;
+        float _max_load;
+
+    public:
+        hash_table() : _hash(hasher()), _eq(key_equal()), _ctrl_alloc(this->_allocator), _ctrl(empty_ctrl()), _slots(0),
+                       _capacity(0), _size(0), _tombstones(0), _max_load(0.875f) {}
+
+        hash_table(size_type bucket_count, const hasher &hash, const key_equal &eq,
+                   const allocator_type &alloc = allocator_type()) :
+                _hash(hash), _eq(eq), _allocator(alloc), _ctrl_alloc(alloc), _ctrl(empty_ctrl()), _slots(0), _capacity(0),
+                _size(0), _tombstones(0), _max_load(0.875f) {
+            rehash(bucket_count);
+        }
+
+        template<class InputIterator>
+        hash_table(InputIterator first, InputIterator last, size_type bucket_count,
+                   const hasher &hash, const key_equal &eq,
+                   const allocator_type &alloc = allocator_type()) :
+                _hash(hash), _eq(eq), _allocator(alloc), _ctrl_alloc(alloc), _ctrl(empty_ctrl()), _slots(0), _capacity(0),
+                _size(0), _tombstones(0), _max_load(0.875f) {
+            rehash(bucket_count);
+            insert(first, last);
+        }
+
+        // Same capacity and the same control bytes, so every value lands in
+        // the slot it had in copy without being hashed again.
+        hash_table(const hash_table &copy) :
+                _hash(copy._hash), _eq(copy._eq), _allocator(select_on_copy(copy._allocator)),
+                _ctrl_alloc(this->_allocator), _ctrl(empty_ctrl()), _slots(0), _capacity(0), _size(0), _tombstones(0),
+                _max_load(copy._max_load) {
+            if (copy._capacity == 0)
+                return;
+            allocate_arrays(copy._capacity, this->_ctrl, this->_slots);
+            this->_capacity = copy._capacity;
+            std::memcpy(this->_ctrl, copy._ctrl, copy._capacity + 1);
+            size_type i = 0;
+            try {
+                for (; i < copy._capacity; i++)
+                    if (copy._ctrl[i] >= 0)
+                        this->_allocator.construct(this->_slots + i, copy._slots[i]);
+            }
+            catch (...) {
+                destroy_slots(this->_ctrl, this->_slots, i);
+                deallocate_arrays(this->_ctrl, this->_slots, this->_capacity);
+                throw;
+            }
+            this->_size = copy._size;
+            this->_tombstones = copy._tombstones;
+        }
+
+        hash_table &operator=(const hash_table &copy) {
+            if (this != &copy) {
+                hash_table tmp(copy);
+
+                swap(tmp);
+            }
+            return (*this);
+        }
+
+        ~hash_table() {
+            destroy_slots(this->_ctrl, this->_slots, this->_capacity);
+            deallocate_arrays(this->_ctrl, this->_slots, this->_capacity);
+        }
+
+        iterator begin() {
+            return (iterator(this->_ctrl, this->_slots).skip_free());
+        }
+
+        const_iterator begin() const {
+            return (const_iterator(this->_ctrl, this->_slots).skip_free());
+        }
+
+        iterator end() {
+            return (iterator(this->_ctrl + this->_capacity, this->_slots + this->_capacity));
+        }
+
+        const_iterator end() const {
+            return (const_iterator(this->_ctrl + this->_capacity, this->_slots + this->_capacity));
+        }
+
+        size_type size() const {
+            return (this->_size);
+        }
+
+        bool empty() const {
+            return (this->_size == 0);
+        }
+
+        size_type max_size() const {
+            return (this->_allocator.max_size());
+        }
+
+        hasher hash_function() const {
+            return (this->_hash);
+        }
+
+        key_equal key_eq() const {
+            return (this->_eq);
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
+        size_type bucket_count() const {
+            return (this->_capacity);
+        }
+
+        float load_factor() const {
+            if (this->_capacity == 0)
+                return (0.0f);
+            return (static_cast<float>(this->_size) / static_cast<float>(this->_capacity));
+        }
+
+        float max_load_factor() const {
+            return (this->_max_load);
+        }
+
+        // Capped below one so every probe sequence still reaches an empty
+        // slot.
+        void max_load_factor(float ml) {
+            if (!(ml > 0.0f))
+                return;
+            this->_max_load = ml > 0.9375f ? 0.9375f : ml;
+            if (this->_capacity != 0 && this->_size + this->_tombstones > max_fill(this->_capacity))
+                resize(capacity_for(this->_size));
+        }
+
+        void rehash(size_type count) {
+            size_type needed = capacity_for(this->_size);
+
+            if (count > needed)
+                needed = round_capacity(count);
+            if (needed == 0) {
+                destroy_slots(this->_ctrl, this->_slots, this->_capacity);
+                deallocate_arrays(this->_ctrl, this->_slots, this->_capacity);
+                this->_ctrl = empty_ctrl();
+                this->_slots = 0;
+                this->_capacity = 0;
+                this->_tombstones = 0;
+            } else if (needed != this->_capacity || this->_tombstones != 0) {
+                resize(needed);
+            }
+        }
+
+        void reserve(size_type count) {
+            size_type needed = capacity_for(count);
+
+            if (needed > this->_capacity)
+                resize(needed);
+        }
+
+        template<class K>
+        ft::pair<iterator, bool> try_emplace(const K &k) {
+            std::size_t h = hash_mix(this->_hash(k));
+            size_type i = find_index(k, h);
+
+            if (i != this->_capacity)
+                return (ft::pair<iterator, bool>(iterator(this->_ctrl + i, this->_slots + i), false));
+            return (ft::pair<iterator, bool>(insert_new(h, value_type(k, typename value_type::second_type())), true));
+        }
+
+        template<class K, class Mapped>
+        ft::pair<iterator, bool> try_emplace(const K &k, const Mapped &obj) {
+            std::size_t h = hash_mix(this->_hash(k));
+            size_type i = find_index(k, h);
+
+            if (i != this->_capacity)
+                return (ft::pair<iterator, bool>(iterator(this->_ctrl + i, this->_slots + i), false));
+            return (ft::pair<iterator, bool>(insert_new(h, value_type(k, obj)), true));
+        }
+
+        ft::pair<iterator, bool> insert(const value_type &val) {
+            std::size_t h = hash_mix(this->_hash(val));
+            size_type i = find_index(val, h);
+
+            if (i != this->_capacity)
+                return (ft::pair<iterator, bool>(iterator(this->_ctrl + i, this->_slots + i), false));
+            return (ft::pair<iterator, bool>(insert_new(h, val), true));
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            (void) position;
+            return (insert(val).first);
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        // Erasing never moves other values, so iterators to them (and the
+        // one after position) stay valid.
+        void erase(iterator position) {
+            erase_index(static_cast<size_type>(position.base() - this->_slots));
+        }
+
+        template<class K>
+        size_type erase(const K &k) {
+            size_type i = find_index(k, hash_mix(this->_hash(k)));
+
+            if (i == this->_capacity)
+                return (0);
+            erase_index(i);
+            return (1);
+        }
+
+        void erase(iterator first, iterator last) {
+            while (first != last)
+                erase(first++);
+        }
+
+        void swap(hash_table &x) {
+            std::swap(this->_hash, x._hash);
+            std::swap(this->_eq, x._eq);
+            std::swap(this->_allocator, x._allocator);
+            std::swap(this->_ctrl_alloc, x._ctrl_alloc);
+            std::swap(this->_ctrl, x._ctrl);
+            std::swap(this->_slots, x._slots);
+            std::swap(this->_capacity, x._capacity);
+            std::swap(this->_size, x._size);
+            std::swap(this->_tombstones, x._tombstones);
+            std::swap(this->_max_load, x._max_load);
+        }
+
+        // Keeps the slots, like std::unordered_map keeps its buckets.
+        void clear() {
+            if (this->_capacity == 0)
+                return;
+            destroy_slots(this->_ctrl, this->_slots, this->_capacity);
+            std::memset(this->_ctrl, hash_empty, this->_capacity);
+            this->_size = 0;
+            this->_tombstones = 0;
+        }
+
+        template<class K>
+        iterator find(const K &k) {
+            size_type i = find_index(k, hash_mix(this->_hash(k)));
+
+            return (iterator(this->_ctrl + i, this->_slots + i));
+        }
+
+        template<class K>
+        const_iterator find(const K &k) const {
+            size_type i = find_index(k, hash_mix(this->_hash(k)));
+
+            return (const_iterator(this->_ctrl + i, this->_slots + i));
+        }
+
+        template<class K>
+        size_type count(const K &k) const {
+            return (find_index(k, hash_mix(this->_hash(k))) != this->_capacity);
+        }
+
+    private:
+        static signed char *empty_ctrl() {
+            return (const_cast<signed char *>(hash_empty_ctrl<void>::bytes));
+        }
+
+        size_type max_fill(size_type capacity) const {
+            size_type fill = static_cast<size_type>(static_cast<double>(capacity) * this->_max_load);
+
+            return (fill < capacity ? fill : capacity - 1);
+        }
+
+        // Smallest power of two, and at least one group, not below count.
+        static size_type round_capacity(size_type count) {
+            size_type capacity = hash_group_width;
+
+            while (capacity < count)
+                capacity *= 2;
+            return (capacity);
+        }
+
+        size_type capacity_for(size_type count) const {
+            if (count == 0)
+                return (0);
+            size_type capacity = round_capacity(count);
+
+            while (max_fill(capacity) < count)
+                capacity *= 2;
+            return (capacity);
+        }
+
+        template<class K>
+        size_type find_index(const K &k, std::size_t h) const {
+            if (this->_capacity == 0)
+                return (0);
+            const size_type mask = this->_capacity / hash_group_width - 1;
+            const signed char h2 = static_cast<signed char>(h & 0x7f);
+            size_type g = (h >> 7) & mask;
+
+            for (size_type step = 1;; step++) {
+                const size_type base = g * hash_group_width;
+                hash_group group(this->_ctrl + base);
+
+                for (unsigned int m = group.match(h2); m != 0; m &= m - 1) {
+                    size_type i = base + hash_lowest_bit(m);
+                    if (this->_eq(this->_slots[i], k))
+                        return (i);
+                }
+                if (group.match_empty() != 0)
+                    return (this->_capacity);
+                g = (g + step) & mask;
+            }
+        }
+
+        static size_type find_free(const signed char *ctrl, size_type capacity, std::size_t h) {
+            const size_type mask = capacity / hash_group_width - 1;
+            size_type g = (h >> 7) & mask;
+
+            for (size_type step = 1;; step++) {
+                const size_type base = g * hash_group_width;
+                unsigned int m = hash_group(ctrl + base).match_empty_or_deleted();
+
+                if (m != 0)
+                    return (base + hash_lowest_bit(m));
+                g = (g + step) & mask;
+            }
+        }
+
+        // Reusing a tombstone costs no growth; taking an empty slot does,
+        // and when none is left the table first drops its tombstones or, if
+        // they would not free enough, doubles.
+        size_type prepare_insert(std::size_t h) {
+            size_type i = this->_capacity == 0 ? 0 : find_free(this->_ctrl, this->_capacity, h);
+
+            if (this->_capacity == 0 ||
+                (this->_ctrl[i] != hash_deleted && this->_size + this->_tombstones >= max_fill(this->_capacity))) {
+                if (this->_capacity != 0 && this->_size < max_fill(this->_capacity) / 2)
+                    resize(this->_capacity);
+                else
+                    resize(capacity_for(this->_size + 1) > this->_capacity * 2 ? capacity_for(this->_size + 1)
+                                                                                  : this->_capacity * 2);
+                i = find_free(this->_ctrl, this->_capacity, h);
+            }
+            return (i);
+        }
+
+        // The caller has already looked the key up and missed.
+        iterator insert_new(std::size_t h, const value_type &val) {
+            size_type i = prepare_insert(h);
+
+            this->_allocator.construct(this->_slots + i, val);
+            if (this->_ctrl[i] == hash_deleted)
+                this->_tombstones--;
+            this->_ctrl[i] = static_cast<signed char>(h & 0x7f);
+            this->_size++;
+            return (iterator(this->_ctrl + i, this->_slots + i));
+        }
+
+        void erase_index(size_type i) {
+            this->_allocator.destroy(this->_slots + i);
+            if (hash_group(this->_ctrl + (i & ~static_cast<size_type>(hash_group_width - 1))).match_empty() != 0) {
+                this->_ctrl[i] = hash_empty;
+            } else {
+                this->_ctrl[i] = hash_deleted;
+                this->_tombstones++;
+            }
+            this->_size--;
+        }
+
+        void allocate_arrays(size_type capacity, signed char *&ctrl, value_type *&slots) {
+            ctrl = this->_ctrl_alloc.allocate(capacity + 1);
+            try {
+                slots = this->_allocator.allocate(capacity);
+            }
+            catch (...) {
+                this->_ctrl_alloc.deallocate(ctrl, capacity + 1);
+                throw;
+            }
+        }
+
+        void deallocate_arrays(signed char *ctrl, value_type *slots, size_type capacity) {
+            if (capacity == 0)
+                return;
+            this->_allocator.deallocate(slots, capacity);
+            this->_ctrl_alloc.deallocate(ctrl, capacity + 1);
+        }
+
+        void destroy_slots(const signed char *ctrl, value_type *slots, size_type capacity) {
+            for (size_type i = 0; i < capacity; i++)
+                if (ctrl[i] >= 0)
+                    this->_allocator.destroy(slots + i);
+        }
+
+        // Copies every value into fresh arrays before touching the old ones,
+        // so a throwing copy leaves the table as it was.
+        void resize(size_type capacity) {
+            signed char *ctrl;
+            value_type *slots;
+
+            allocate_arrays(capacity, ctrl, slots);
+            std::memset(ctrl, hash_empty, capacity);
+            ctrl[capacity] = hash_sentinel;
+            try {
+                for (size_type i = 0; i < this->_capacity; i++) {
+                    if (this->_ctrl[i] < 0)
+                        continue;
+                    std::size_t h = hash_mix(this->_hash(this->_slots[i]));
+                    size_type j = find_free(ctrl, capacity, h);
+                    this->_allocator.construct(slots + j, this->_slots[i]);
+                    ctrl[j] = static_cast<signed char>(h & 0x7f);
+                }
+            }
+            catch (...) {
+                destroy_slots(ctrl, slots, capacity);
+                deallocate_arrays(ctrl, slots, capacity);
+                throw;
+            }
+            destroy_slots(this->_ctrl, this->_slots, this->_capacity);
+            deallocate_arrays(this->_ctrl, this->_slots, this->_capacity);
+            this->_ctrl = ctrl;
+            this->_slots = slots;
+            this->_capacity = capacity;
+            this->_tombstones = 0;
+        }
+    };
+}
+
+#endif
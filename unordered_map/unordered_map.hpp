@@ -0,0 +1,281 @@
+#ifndef UNORDERED_MAP
+#define UNORDERED_MAP
+
+#include <functional>
+#include "../util/util.hpp"
+#include "hash_table.hpp"
+
+namespace ft {
+    // Iterators are forward only and come out in slot order. Insertions that
+    // grow or rehash the table invalidate them; erase invalidates only the
+    // erased element.
+    template<class Key, class value, class Hash = hash<Key>, class KeyEqual = std::equal_to<Key>,
+            class Allocator = std::allocator<pair<const Key, value> > >
+    class unordered_map {
+    public:
+        typedef Key key_type;
+        typedef value mapped_type;
+
+        typedef pair<const Key, value> value_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+
+        typedef Allocator allocator_type;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef std::ptrdiff_t difference_type;
+        typedef std::size_t size_type;
+        class pair_hash {
+            friend class unordered_map;
+        protected:
+            Hash hash;
+            pair_hash(Hash h) : hash(h) {}
+        public:
+            pair_hash() {}
+            std::size_t operator()(const value_type &x) const {
+                return hash(x.first);
+            }
+
+            template<class K>
+            std::size_t operator()(const K &x) const {
+                return hash(x);
+            }
+        };
+
+        class pair_equal {
+            friend class unordered_map;
+        protected:
+            KeyEqual eq;
+            pair_equal(KeyEqual e) : eq(e) {}
+        public:
+            pair_equal() {}
+            bool operator()(const value_type &x, const value_type &y) const {
+                return eq(x.first, y.first);
+            }
+
+            template<class K>
+            bool operator()(const value_type &x, const K &y) const {
+                return eq(x.first, y);
+            }
+        };
+
+        typedef hash_table<value_type, pair_hash, pair_equal, allocator_type> table_type;
+        typedef typename table_type::iterator iterator;
+        typedef typename table_type::const_iterator const_iterator;
+
+    private:
+        hasher _hash;
+        key_equal _eq;
+        table_type _table;
+
+    public:
+        explicit unordered_map(size_type bucket_count = 0,
+                               const hasher &hash = hasher(),
+                               const key_equal &eq = key_equal(),
+                               const allocator_type &alloc = allocator_type())
+                : _hash(hash), _eq(eq), _table(bucket_count, hash, eq, alloc) {}
+
+        template<class InputIterator>
+        unordered_map(InputIterator first, InputIterator last,
+                      size_type bucket_count = 0,
+                      const hasher &hash = hasher(),
+                      const key_equal &eq = key_equal(),
+                      const allocator_type &alloc = allocator_type())
+                : _hash(hash), _eq(eq), _table(first, last, bucket_count, hash, eq, alloc) {}
+
+        unordered_map(const unordered_map &x) : _hash(x._hash), _eq(x._eq), _table(x._table) {}
+
+        unordered_map &operator=(const unordered_map &x) {
+            if (this != &x) {
+                this->_table = x._table;
+                this->_hash = x._hash;
+                this->_eq = x._eq;
+            }
+            return (*this);
+        }
+
+        ~unordered_map() {}
+
+        iterator begin() {
+            return (this->_table.begin());
+        }
+
+        const_iterator begin() const {
+            return (this->_table.begin());
+        }
+
+        iterator end() {
+            return (this->_table.end());
+        }
+
+        const_iterator end() const {
+            return (this->_table.end());
+        }
+
+        bool empty() const {
+            return (this->_table.empty());
+        }
+
+        size_type size() const {
+            return (this->_table.size());
+        }
+
+        size_type max_size() const {
+            return (this->_table.max_size());
+        }
+
+        mapped_type &operator[](const key_type &k) {
+            return (this->_table.try_emplace(k).first->second);
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k) {
+            return (this->_table.try_emplace(k));
+        }
+
+        pair<iterator, bool> try_emplace(const key_type &k, const mapped_type &obj) {
+            return (this->_table.try_emplace(k, obj));
+        }
+
+        pair<iterator, bool> insert_or_assign(const key_type &k, const mapped_type &obj) {
+            pair<iterator, bool> res = this->_table.try_emplace(k, obj);
+
+            if (res.second == false)
+                res.first->second = obj;
+            return (res);
+        }
+
+        pair<iterator, bool> insert(const value_type &val) {
+            return (this->_table.insert(val));
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            return (this->_table.insert(position, val));
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            return (this->_table.insert(first, last));
+        }
+
+        void erase(iterator position) {
+            this->_table.erase(position);
+        }
+
+        size_type erase(const key_type &k) {
+            return (this->_table.erase(k));
+        }
+
+        void erase(iterator first, iterator last) {
+            this->_table.erase(first, last);
+        }
+
+        void swap(unordered_map &x) {
+            this->_table.swap(x._table);
+            std::swap(this->_hash, x._hash);
+            std::swap(this->_eq, x._eq);
+        }
+
+        void clear() {
+            this->_table.clear();
+        }
+
+        hasher hash_function() const {
+            return (this->_hash);
+        }
+
+        key_equal key_eq() const {
+            return (this->_eq);
+        }
+
+        iterator find(const key_type &k) {
+            return (this->_table.find(k));
+        }
+
+        const_iterator find(const key_type &k) const {
+            return (this->_table.find(k));
+        }
+
+        size_type count(const key_type &k) const {
+            return (this->_table.count(k));
+        }
+
+        pair<iterator, iterator> equal_range(const key_type &k) {
+            iterator it = this->_table.find(k);
+
+            if (it == this->_table.end())
+                return (pair<iterator, iterator>(it, it));
+            iterator next = it;
+            return (pair<iterator, iterator>(it, ++next));
+        }
+
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const {
+            const_iterator it = this->_table.find(k);
+
+            if (it == this->_table.end())
+                return (pair<const_iterator, const_iterator>(it, it));
+            const_iterator next = it;
+            return (pair<const_iterator, const_iterator>(it, ++next));
+        }
+
+        size_type bucket_count() const {
+            return (this->_table.bucket_count());
+        }
+
+        float load_factor() const {
+            return (this->_table.load_factor());
+        }
+
+        float max_load_factor() const {
+            return (this->_table.max_load_factor());
+        }
+
+        void max_load_factor(float ml) {
+            this->_table.max_load_factor(ml);
+        }
+
+        void rehash(size_type count) {
+            this->_table.rehash(count);
+        }
+
+        void reserve(size_type count) {
+            this->_table.reserve(count);
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_table.get_allocator());
+        }
+    };
+
+    // Unordered, so equal maps may iterate in different orders: every entry
+    // of lhs is looked up in rhs instead.
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc>
+    bool operator==(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs,
+                    const unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs) {
+        typedef typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator const_iterator;
+
+        if (lhs.size() != rhs.size())
+            return (false);
+        for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+            const_iterator other = rhs.find(it->first);
+            if (other == rhs.end() || !(other->second == it->second))
+                return (false);
+        }
+        return (true);
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc>
+    bool operator!=(const unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs,
+                    const unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<class Key, class T, class Hash, class KeyEqual, class Alloc>
+    void swap(unordered_map<Key, T, Hash, KeyEqual, Alloc> &lhs, unordered_map<Key, T, Hash, KeyEqual, Alloc> &rhs) {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
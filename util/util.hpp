@@ -1,6 +1,20 @@
 #ifndef UTILL
 #define UTILL
 
+// Built as C++11 or later, the containers also get move construction and
+// assignment, rvalue insertion and emplace. Code shared by both modes goes
+// through FT_MOVE and FT_MOVE_IF_NOEXCEPT, which copy under C++98.
+#if __cplusplus >= 201103L
+# define FT_HAS_MOVE 1
+# include <utility>
+# define FT_MOVE(x) std::move(x)
+# define FT_MOVE_IF_NOEXCEPT(x) std::move_if_noexcept(x)
+#else
+# define FT_HAS_MOVE 0
+# define FT_MOVE(x) (x)
+# define FT_MOVE_IF_NOEXCEPT(x) (x)
+#endif
+
 namespace ft {
     template<bool Cond, class T = void>
     struct enable_if {
@@ -20,6 +34,9 @@ namespace ft {
         operator T() const { return v; }
     };
 
+    typedef integral_constant<bool, true> true_type;
+    typedef integral_constant<bool, false> false_type;
+
     template<class T>
     struct is_integral : public integral_constant<bool, false> {
     };
@@ -77,6 +94,92 @@ namespace ft {
     };
 
 
+    template<class T, class U>
+    struct is_same : public integral_constant<bool, false> {
+    };
+
+    template<class T>
+    struct is_same<T, T> : public integral_constant<bool, true> {
+    };
+
+    // True when copying a T is a plain memcpy and destroying one does
+    // nothing, so containers may move T with memcpy/memmove. The compiler
+    // builtins catch PODs and aggregates of them; on other compilers only
+    // integers and pointers qualify. Specialize this for your own types to
+    // opt them in.
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+# define FT_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#elif defined(__GNUC__)
+# define FT_TRIVIALLY_COPYABLE(T) (__has_trivial_copy(T) && __has_trivial_assign(T) && __has_trivial_destructor(T))
+#else
+# define FT_TRIVIALLY_COPYABLE(T) false
+#endif
+
+    template<class T>
+    struct is_trivially_copyable
+            : public integral_constant<bool, is_integral<T>::value || FT_TRIVIALLY_COPYABLE(T)> {
+    };
+
+    template<class T>
+    struct is_trivially_copyable<T *> : public true_type {
+    };
+
+    template<class T>
+    struct void_type {
+        typedef void type;
+    };
+
+    template<class Compare, class Enable = void>
+    struct is_transparent : public integral_constant<bool, false> {
+    };
+
+    template<class Compare>
+    struct is_transparent<Compare, typename void_type<typename Compare::is_transparent>::type>
+            : public integral_constant<bool, true> {
+    };
+
+    // The allocator a container's copy should use, as C++11's
+    // allocator_traits::select_on_container_copy_construction: the
+    // allocator's own member of that name when it has one, else a copy.
+    template<class Alloc>
+    struct has_select_on_copy {
+        template<class U, U (U::*)() const>
+        struct check {
+        };
+
+        template<class U>
+        static char test(check<U, &U::select_on_container_copy_construction> *);
+
+        template<class U>
+        static long test(...);
+
+        static const bool value = sizeof(test<Alloc>(0)) == sizeof(char);
+    };
+
+    template<class Alloc>
+    Alloc select_on_copy(const Alloc &alloc, true_type) {
+        return (alloc.select_on_container_copy_construction());
+    }
+
+    template<class Alloc>
+    Alloc select_on_copy(const Alloc &alloc, false_type) {
+        return (alloc);
+    }
+
+    template<class Alloc>
+    Alloc select_on_copy(const Alloc &alloc) {
+        return (select_on_copy(alloc, integral_constant<bool, has_select_on_copy<Alloc>::value>()));
+    }
+
+    struct transparent_less {
+        typedef void is_transparent;
+
+        template<class A, class B>
+        bool operator()(const A &a, const B &b) const {
+            return (a < b);
+        }
+    };
+
     template<class InputIterator1, class InputIterator2>
     bool equal(InputIterator1 first1, InputIterator1 last1,
                InputIterator2 first2) {
@@ -126,6 +229,12 @@ namespace ft {
             this->second = pr.second;
             return (*this);
         }
+#if FT_HAS_MOVE
+
+        pair(pair &&) = default;
+
+        pair &operator=(pair &&) = default;
+#endif
     };
 
     template<class T1, class T2>
@@ -151,6 +260,12 @@ namespace ft {
             this->second = pr.second;
             return (*this);
         }
+#if FT_HAS_MOVE
+
+        pair(pair &&) = default;
+
+        pair &operator=(pair &&) = default;
+#endif
     };
 
 
@@ -158,6 +273,36 @@ namespace ft {
     pair<T1, T2> make_pair(T1 x, T2 y) {
         return (pair<T1, T2>(x, y));
     }
+
+    template<class T1, class T2>
+    bool operator==(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    };
+
+    template<class T1, class T2>
+    bool operator!=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
+        return !(lhs == rhs);
+    };
+
+    template<class T1, class T2>
+    bool operator<(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
+        return lhs.first < rhs.first || (!(rhs.first < lhs.first) && lhs.second < rhs.second);
+    };
+
+    template<class T1, class T2>
+    bool operator<=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
+        return !(rhs < lhs);
+    };
+
+    template<class T1, class T2>
+    bool operator>(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
+        return rhs < lhs;
+    };
+
+    template<class T1, class T2>
+    bool operator>=(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
+        return !(lhs < rhs);
+    };
 }
 
 #endif
\ No newline at end of file
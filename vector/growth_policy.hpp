@@ -0,0 +1,62 @@
+#ifndef GROWTH_POLICY
+#define GROWTH_POLICY
+
+#include <cstddef>
+
+namespace ft {
+    // A growth policy picks the capacity a vector grows to once it needs room
+    // for required elements. vector has already checked that required does
+    // not exceed max_size; the result must lie in [required, max_size].
+
+    // Multiplies the capacity by Num / Den. growth_factor<2, 1> is the
+    // default; growth_factor<3, 2> lets a freed block be reused by a later
+    // reallocation and needs at most 2.5x the data while growing, not 3x.
+    template<std::size_t Num, std::size_t Den>
+    struct growth_factor {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                         std::size_t max_size, std::size_t) {
+            std::size_t grown;
+
+            if (capacity > max_size / Num * Den)
+                grown = max_size;
+            else
+                grown = capacity / Den * Num + capacity % Den * Num / Den;
+            return (grown > required ? grown : required);
+        }
+    };
+
+    // Grows by whole chunks of Bytes, so no more than one chunk is ever
+    // unused. Each growth copies everything, so total copying is quadratic:
+    // meant for large vectors whose final size is roughly known.
+    template<std::size_t Bytes>
+    struct growth_chunk {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                         std::size_t max_size, std::size_t elem_size) {
+            std::size_t chunk = Bytes / elem_size > 0 ? Bytes / elem_size : 1;
+
+            if (max_size < chunk || capacity > max_size - chunk || required > max_size - chunk)
+                return (max_size);
+            std::size_t wanted = capacity + chunk > required ? capacity + chunk : required;
+            return ((wanted + chunk - 1) / chunk * chunk);
+        }
+    };
+
+    // Applies Base, then rounds the block up to a whole number of pages.
+    // Large blocks come straight from mmap anyway, so the rounding is free
+    // memory that would otherwise sit unused at the end of the last page.
+    template<class Base = growth_factor<2, 1>, std::size_t PageSize = 4096>
+    struct growth_page {
+        static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                         std::size_t max_size, std::size_t elem_size) {
+            std::size_t wanted = Base::next_capacity(capacity, required, max_size, elem_size);
+
+            if (wanted > (static_cast<std::size_t>(-1) - PageSize) / elem_size)
+                return (wanted);
+            std::size_t pages = (wanted * elem_size + PageSize - 1) / PageSize;
+            std::size_t rounded = pages * PageSize / elem_size;
+            return (rounded < max_size ? rounded : max_size);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,575 @@
+#ifndef SMALL_VECTOR
+#define SMALL_VECTOR
+
+#include <memory>
+#include <stdexcept>
+#include "vector_iterator.hpp"
+#include "vector_ops.hpp"
+#include "growth_policy.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../util/util.hpp"
+
+namespace ft {
+    // A vector that keeps up to N elements inside the object itself and
+    // only allocates once it outgrows them. The interface and iterators are
+    // vector's. While the elements are inline, swap and moves copy them one
+    // by one and invalidate iterators, unlike vector's.
+    template<class T, std::size_t N, class Allocator = std::allocator<T>, class Growth = growth_factor<2, 1> >
+    class small_vector {
+    public:
+        typedef T value_type;
+        typedef Allocator allocator_type;
+        typedef Growth growth_policy;
+        typedef typename allocator_type::reference reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::size_type size_type;
+        typedef typename allocator_type::difference_type difference_type;
+        typedef typename allocator_type::pointer pointer;
+        typedef typename allocator_type::const_pointer const_pointer;
+
+        typedef vector_iterator<value_type> iterator;
+        typedef vector_iterator<const value_type> const_iterator;
+
+        typedef ft::reverse_iterator<iterator> reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    private:
+        pointer _begin;
+        size_type _size;
+        size_type _capacity;
+        allocator_type _allocator;
+        union {
+            char raw[N * sizeof(T)];
+            long double align_ld;
+            long long align_ll;
+            void *align_p;
+        } _inline;
+
+        typedef vector_ops<T, Allocator> ops;
+        typedef typename ops::trivial trivial_tag;
+
+    public:
+        explicit small_vector(const allocator_type &alloc = allocator_type())
+                : _begin(inline_begin()), _size(0), _capacity(N), _allocator(alloc) {}
+
+        explicit small_vector(size_type n, const value_type &val = value_type(),
+                              const allocator_type &alloc = allocator_type())
+                : _begin(inline_begin()), _size(0), _capacity(N), _allocator(alloc) {
+            this->reserve(n);
+            try {
+                std::uninitialized_fill_n(this->_begin, n, val);
+            } catch (...) {
+                release();
+                throw;
+            }
+            this->_size = n;
+        }
+
+        small_vector(size_type n, default_init_t, const allocator_type &alloc = allocator_type())
+                : _begin(inline_begin()), _size(0), _capacity(N), _allocator(alloc) {
+            this->reserve(n);
+            try {
+                ops::default_construct(this->_allocator, this->_begin, n);
+            } catch (...) {
+                release();
+                throw;
+            }
+            this->_size = n;
+        }
+
+        template<class InputIterator>
+        small_vector(InputIterator first, InputIterator last,
+                     const allocator_type &alloc = allocator_type(),
+                     typename enable_if<!is_integral<InputIterator>::value>::type * = 0)
+                : _begin(inline_begin()), _size(0), _capacity(N), _allocator(alloc) {
+            difference_type n = std::distance(first, last);
+
+            if (n < 0)
+                throw std::length_error("small_vector");
+            this->reserve(static_cast<size_type>(n));
+            try {
+                std::uninitialized_copy(first, last, this->_begin);
+            } catch (...) {
+                release();
+                throw;
+            }
+            this->_size = static_cast<size_type>(n);
+        }
+
+        small_vector(const small_vector &x)
+                : _begin(inline_begin()), _size(0), _capacity(N), _allocator(x._allocator) {
+            if (x._size > N) {
+                this->_begin = this->_allocator.allocate(x._size);
+                this->_capacity = x._size;
+            }
+            try {
+                ops::copy_construct(this->_allocator, this->_begin, x._begin, x._size, trivial_tag());
+            } catch (...) {
+                release();
+                throw;
+            }
+            this->_size = x._size;
+        }
+
+        // Copy and swap, so an element of x that throws while being copied
+        // leaves *this untouched.
+        small_vector &operator=(const small_vector &x) {
+            if (this != &x) {
+                small_vector tmp(x);
+
+                this->swap(tmp);
+            }
+            return (*this);
+        }
+#if FT_HAS_MOVE
+
+        small_vector(small_vector &&x)
+                : _begin(inline_begin()), _size(0), _capacity(N), _allocator(x._allocator) {
+            take(x);
+        }
+
+        small_vector &operator=(small_vector &&x) {
+            if (this != &x) {
+                clear();
+                take(x);
+            }
+            return (*this);
+        }
+#endif
+
+        ~small_vector() {
+            clear();
+            release();
+        }
+
+        iterator begin() {
+            return (iterator(this->_begin));
+        }
+
+        const_iterator begin() const {
+            return (const_iterator(this->_begin));
+        }
+
+        iterator end() {
+            return (iterator(this->_begin + this->_size));
+        }
+
+        const_iterator end() const {
+            return (const_iterator(this->_begin + this->_size));
+        }
+
+        reverse_iterator rbegin() {
+            return (reverse_iterator(this->end()));
+        }
+
+        const_reverse_iterator rbegin() const {
+            return (const_reverse_iterator(this->end()));
+        }
+
+        reverse_iterator rend() {
+            return (reverse_iterator(this->begin()));
+        }
+
+        const_reverse_iterator rend() const {
+            return (const_reverse_iterator(this->begin()));
+        }
+
+        size_type size() const {
+            return (this->_size);
+        }
+
+        size_type max_size() const {
+            return (this->_allocator.max_size());
+        }
+
+        void resize(size_type n, value_type val = value_type()) {
+            if (n < this->_size) {
+                ops::destroy_range(this->_allocator, this->_begin + n, this->_begin + this->_size, trivial_tag());
+                this->_size = n;
+                return;
+            }
+            if (n > this->_capacity)
+                this->reserve(grown_capacity(n - this->_size));
+            std::uninitialized_fill_n(this->_begin + this->_size, n - this->_size, val);
+            this->_size = n;
+        }
+
+        void resize(size_type n, default_init_t) {
+            if (n <= this->_size) {
+                ops::destroy_range(this->_allocator, this->_begin + n, this->_begin + this->_size, trivial_tag());
+                this->_size = n;
+                return;
+            }
+            this->append(n - this->_size, default_init);
+        }
+
+        // As vector::append: n default-initialized elements at the end,
+        // returned for the caller to fill in.
+        iterator append(size_type n, default_init_t) {
+            if (n > this->_capacity - this->_size)
+                this->reserve(grown_capacity(n));
+            ops::default_construct(this->_allocator, this->_begin + this->_size, n);
+            this->_size += n;
+            return (this->end() - n);
+        }
+
+        size_type capacity() const {
+            return (this->_capacity);
+        }
+
+        bool empty() const {
+            return (this->_size == 0);
+        }
+
+        void reserve(size_type n) {
+            if (n <= this->_capacity)
+                return;
+            if (n > this->max_size())
+                throw std::length_error("small_vector");
+            relocate_around(this->_allocator.allocate(n), n, this->_size, 0);
+        }
+
+        reference operator[](size_type n) {
+            return (this->_begin[n]);
+        }
+
+        const_reference operator[](size_type n) const {
+            return (this->_begin[n]);
+        }
+
+        reference at(size_type n) {
+            if (n >= this->_size)
+                throw std::out_of_range("small_vector out of range");
+            return (this->_begin[n]);
+        }
+
+        const_reference at(size_type n) const {
+            if (n >= this->_size)
+                throw std::out_of_range("small_vector out of range");
+            return (this->_begin[n]);
+        }
+
+        reference front() {
+            return (*(this->_begin));
+        }
+
+        const_reference front() const {
+            return (*(this->_begin));
+        }
+
+        reference back() {
+            return (this->_begin[this->_size - 1]);
+        }
+
+        const_reference back() const {
+            return (this->_begin[this->_size - 1]);
+        }
+
+        void assign(size_type n, const value_type &u) {
+            clear();
+            resize(n, u);
+        }
+
+        template<class InputIterator>
+        void assign(InputIterator first, InputIterator last,
+                    typename enable_if<!is_integral<InputIterator>::value>::type * = 0) {
+            size_type n = static_cast<size_type>(std::distance(first, last));
+
+            clear();
+            this->reserve(n);
+            std::uninitialized_copy(first, last, this->_begin);
+            this->_size = n;
+        }
+
+        void push_back(const value_type &x) {
+            if (this->_size >= this->_capacity) {
+                insert(this->end(), x);
+                return;
+            }
+            this->_allocator.construct(this->_begin + this->_size, x);
+            this->_size++;
+        }
+#if FT_HAS_MOVE
+
+        void push_back(value_type &&x) {
+            emplace_back(std::move(x));
+        }
+
+        template<class... Args>
+        reference emplace_back(Args &&... args) {
+            if (this->_size >= this->_capacity)
+                return (*emplace(this->end(), std::forward<Args>(args)...));
+            this->_allocator.construct(this->_begin + this->_size, std::forward<Args>(args)...);
+            this->_size++;
+            return (this->back());
+        }
+#endif
+
+        void pop_back() {
+            this->_allocator.destroy(this->_begin + this->_size - 1);
+            this->_size--;
+        }
+
+        iterator insert(iterator position, const value_type &val) {
+            size_type d_size = static_cast<size_type>(position - this->begin());
+
+            if (this->_size == this->_capacity) {
+                size_type new_capacity = grown_capacity(1);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    this->_allocator.construct(new_begin + d_size, val);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
+                }
+                relocate_around(new_begin, new_capacity, d_size, 1);
+            } else if (d_size == this->_size) {
+                this->_allocator.construct(this->_begin + this->_size, val);
+                this->_size++;
+            } else {
+                value_type tmp(val);
+
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, 1, trivial_tag());
+                this->_allocator.construct(this->_begin + d_size, FT_MOVE(tmp));
+                this->_size++;
+            }
+            return (this->begin() + d_size);
+        }
+#if FT_HAS_MOVE
+
+        iterator insert(iterator position, value_type &&val) {
+            return (emplace(position, std::move(val)));
+        }
+
+        template<class... Args>
+        iterator emplace(iterator position, Args &&... args) {
+            size_type d_size = static_cast<size_type>(position - this->begin());
+
+            if (this->_size == this->_capacity) {
+                size_type new_capacity = grown_capacity(1);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    this->_allocator.construct(new_begin + d_size, std::forward<Args>(args)...);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
+                }
+                relocate_around(new_begin, new_capacity, d_size, 1);
+            } else if (d_size == this->_size) {
+                this->_allocator.construct(this->_begin + this->_size, std::forward<Args>(args)...);
+                this->_size++;
+            } else {
+                value_type tmp(std::forward<Args>(args)...);
+
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, 1, trivial_tag());
+                this->_allocator.construct(this->_begin + d_size, std::move(tmp));
+                this->_size++;
+            }
+            return (this->begin() + d_size);
+        }
+#endif
+
+        void insert(iterator position, size_type n, const value_type &val) {
+            size_type d_size = static_cast<size_type>(position - this->begin());
+
+            if (n == 0)
+                return;
+            if (this->_size + n > this->_capacity) {
+                size_type new_capacity = grown_capacity(n);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    std::uninitialized_fill_n(new_begin + d_size, n, val);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
+                }
+                relocate_around(new_begin, new_capacity, d_size, n);
+            } else {
+                value_type tmp(val);
+
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, n, trivial_tag());
+                std::uninitialized_fill_n(this->_begin + d_size, n, tmp);
+                this->_size += n;
+            }
+        }
+
+        template<class InputIterator>
+        void insert(iterator position, InputIterator first, InputIterator last,
+                    typename enable_if<!is_integral<InputIterator>::value>::type * = 0) {
+            size_type d_size = static_cast<size_type>(position - this->begin());
+            size_type n = static_cast<size_type>(std::distance(first, last));
+
+            if (n == 0)
+                return;
+            if (this->_size + n > this->_capacity) {
+                size_type new_capacity = grown_capacity(n);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    std::uninitialized_copy(first, last, new_begin + d_size);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
+                }
+                relocate_around(new_begin, new_capacity, d_size, n);
+            } else {
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, n, trivial_tag());
+                std::uninitialized_copy(first, last, this->_begin + d_size);
+                this->_size += n;
+            }
+        }
+
+        iterator erase(const_iterator position) {
+            size_type d_size = static_cast<size_type>(position - this->begin());
+
+            ops::close_gap(this->_allocator, this->_begin, this->_size, d_size, 1, trivial_tag());
+            this->_size--;
+            return (this->begin() + d_size);
+        }
+
+        iterator erase(iterator first, iterator last) {
+            size_type pos = static_cast<size_type>(first - this->begin());
+            size_type n = static_cast<size_type>(last - first);
+
+            if (n == 0)
+                return (first);
+            ops::close_gap(this->_allocator, this->_begin, this->_size, pos, n, trivial_tag());
+            this->_size -= n;
+            return (first);
+        }
+
+        void swap(small_vector &x) {
+            if (this->_begin != inline_begin() && x._begin != x.inline_begin()) {
+                std::swap(this->_begin, x._begin);
+                std::swap(this->_size, x._size);
+                std::swap(this->_capacity, x._capacity);
+                std::swap(this->_allocator, x._allocator);
+                return;
+            }
+            small_vector tmp(this->_allocator);
+
+            tmp.take(*this);
+            this->take(x);
+            x.take(tmp);
+        }
+
+        void clear() {
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
+            this->_size = 0;
+        }
+
+        allocator_type get_allocator() const {
+            return (this->_allocator);
+        }
+
+    private:
+        pointer inline_begin() {
+            return (reinterpret_cast<pointer>(this->_inline.raw));
+        }
+
+        const_pointer inline_begin() const {
+            return (reinterpret_cast<const_pointer>(this->_inline.raw));
+        }
+
+        // Frees the heap block, if any, and goes back to the inline storage.
+        // The elements must already be destroyed.
+        void release() {
+            if (this->_begin != inline_begin())
+                this->_allocator.deallocate(this->_begin, this->_capacity);
+            this->_begin = inline_begin();
+            this->_capacity = N;
+        }
+
+        // Takes over x's elements, leaving x empty; *this must be empty. A
+        // heap block changes hands, inline elements are moved one by one.
+        void take(small_vector &x) {
+            if (x._begin != x.inline_begin()) {
+                release();
+                this->_allocator = x._allocator;
+                this->_begin = x._begin;
+                this->_size = x._size;
+                this->_capacity = x._capacity;
+                x._begin = x.inline_begin();
+                x._size = 0;
+                x._capacity = N;
+                return;
+            }
+            ops::transfer(this->_allocator, this->_begin, x._begin, x._size, trivial_tag());
+            this->_size = x._size;
+            x.clear();
+        }
+
+        // The capacity to reallocate to for n more elements.
+        size_type grown_capacity(size_type n) const {
+            if (n > this->max_size() - this->_size)
+                throw std::length_error("small_vector");
+            return (growth_policy::next_capacity(this->_capacity, this->_size + n, this->max_size(),
+                                                 sizeof(value_type)));
+        }
+
+        // Moves every element into new_begin around slots [pos, pos + n),
+        // which the caller has already filled, and frees the old heap block.
+        // If an element throws, the gap and new_begin are released and the
+        // vector is left as it was.
+        void relocate_around(pointer new_begin, size_type new_capacity, size_type pos, size_type n) {
+            try {
+                ops::transfer(this->_allocator, new_begin, this->_begin, pos, trivial_tag());
+                try {
+                    ops::transfer(this->_allocator, new_begin + pos + n, this->_begin + pos, this->_size - pos,
+                                  trivial_tag());
+                } catch (...) {
+                    ops::destroy_range(this->_allocator, new_begin, new_begin + pos, trivial_tag());
+                    throw;
+                }
+            } catch (...) {
+                ops::destroy_range(this->_allocator, new_begin + pos, new_begin + pos + n, trivial_tag());
+                this->_allocator.deallocate(new_begin, new_capacity);
+                throw;
+            }
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
+            if (this->_begin != inline_begin())
+                this->_allocator.deallocate(this->_begin, this->_capacity);
+            this->_begin = new_begin;
+            this->_capacity = new_capacity;
+            this->_size += n;
+        }
+    };
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    bool operator==(const small_vector<T, N, Allocator, Growth> &x, const small_vector<T, N, Allocator, Growth> &y) {
+        if (x.size() != y.size())
+            return (false);
+        return (ft::equal(x.begin(), x.end(), y.begin()));
+    }
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    bool operator<(const small_vector<T, N, Allocator, Growth> &x, const small_vector<T, N, Allocator, Growth> &y) {
+        return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()));
+    }
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    bool operator!=(const small_vector<T, N, Allocator, Growth> &x, const small_vector<T, N, Allocator, Growth> &y) {
+        return (!(x == y));
+    }
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    bool operator>(const small_vector<T, N, Allocator, Growth> &x, const small_vector<T, N, Allocator, Growth> &y) {
+        return (y < x);
+    }
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    bool operator>=(const small_vector<T, N, Allocator, Growth> &x, const small_vector<T, N, Allocator, Growth> &y) {
+        return (!(x < y));
+    }
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    bool operator<=(const small_vector<T, N, Allocator, Growth> &x, const small_vector<T, N, Allocator, Growth> &y) {
+        return (!(y < x));
+    }
+
+    template<class T, std::size_t N, class Allocator, class Growth>
+    void swap(small_vector<T, N, Allocator, Growth> &x, small_vector<T, N, Allocator, Growth> &y) {
+        x.swap(y);
+    }
+}
+
+#endif
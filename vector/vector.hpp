@@ -2,16 +2,22 @@
 #define VECTOR
 
 #include <iostream>
+#include <memory>
 #include "vector_iterator.hpp"
+#include "vector_ops.hpp"
+#include "growth_policy.hpp"
 #include "../iterator/reverse_iterator.hpp"
 #include "../util/util.hpp"
 
 namespace ft {
-    template<class T, class Allocator = std::allocator<T> >
+    // Growth decides how far the storage grows when it runs out; see
+    // growth_policy.hpp. reserve always allocates exactly what it is asked.
+    template<class T, class Allocator = std::allocator<T>, class Growth = growth_factor<2, 1> >
     class vector {
     public:
         typedef T value_type;
         typedef Allocator allocator_type;
+        typedef Growth growth_policy;
         typedef typename allocator_type::reference reference;
         typedef typename allocator_type::const_reference const_reference;
         typedef typename allocator_type::size_type size_type;
@@ -31,6 +37,9 @@ namespace ft {
         size_type _capacity;
         allocator_type _allocator;
 
+        typedef vector_ops<T, Allocator> ops;
+        typedef typename ops::trivial trivial_tag;
+
     public:
         explicit vector(const allocator_type &alloc = allocator_type()) {
             this->_allocator = alloc;
@@ -49,6 +58,22 @@ namespace ft {
                 this->_allocator.construct(this->_begin + i, val);
         }
 
+        vector(size_type n, default_init_t, const allocator_type &alloc = allocator_type()) {
+            this->_allocator = alloc;
+            this->_begin = NULL;
+            this->_size = 0;
+            this->_capacity = 0;
+            this->reserve(n);
+            try {
+                ops::default_construct(this->_allocator, this->_begin, n);
+            } catch (...) {
+                if (this->_capacity != 0)
+                    this->_allocator.deallocate(this->_begin, this->_capacity);
+                throw;
+            }
+            this->_size = n;
+        }
+
         template<class InputIterator>
         vector(InputIterator first, InputIterator last,
                const allocator_type &alloc = allocator_type(),
@@ -64,32 +89,64 @@ namespace ft {
         }
 
         vector(const vector &x) {
+            this->_begin = NULL;
             this->_size = 0;
             this->_capacity = 0;
-            *this = x;
+            try {
+                *this = x;
+            } catch (...) {
+                if (this->_capacity != 0)
+                    this->_allocator.deallocate(this->_begin, this->_capacity);
+                throw;
+            }
         }
 
         vector &operator=(const vector &x) {
             if (this == &x)
                 return (*this);
 
-            for (size_type i = 0; i < this->_size; i++)
-                this->_allocator.destroy(this->_begin + i);
-            this->_size = x._size;
-            if (this->_capacity < this->_size) {
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
+            this->_size = 0;
+            if (this->_capacity < x._size) {
                 if (this->_capacity != 0)
                     this->_allocator.deallocate(this->_begin, this->_capacity);
-                this->_capacity = this->_size;
-                this->_begin = this->_allocator.allocate(this->_capacity);
+                this->_begin = NULL;
+                this->_capacity = 0;
+                this->_begin = this->_allocator.allocate(x._size);
+                this->_capacity = x._size;
             }
-            for (size_type i = 0; i < this->_size; i++)
-                this->_allocator.construct(this->_begin + i, x._begin[i]);
+            ops::copy_construct(this->_allocator, this->_begin, x._begin, x._size, trivial_tag());
+            this->_size = x._size;
             return (*this);
         }
+#if FT_HAS_MOVE
+
+        vector(vector &&x) noexcept
+                : _begin(x._begin), _size(x._size), _capacity(x._capacity), _allocator(std::move(x._allocator)) {
+            x._begin = NULL;
+            x._size = 0;
+            x._capacity = 0;
+        }
+
+        vector &operator=(vector &&x) noexcept {
+            if (this == &x)
+                return (*this);
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
+            if (this->_capacity != 0)
+                this->_allocator.deallocate(this->_begin, this->_capacity);
+            this->_begin = x._begin;
+            this->_size = x._size;
+            this->_capacity = x._capacity;
+            this->_allocator = std::move(x._allocator);
+            x._begin = NULL;
+            x._size = 0;
+            x._capacity = 0;
+            return (*this);
+        }
+#endif
 
         ~vector() {
-            for (size_type i = 0; i < this->_size; i++)
-                this->_allocator.destroy(this->_begin + i);
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
             if (this->_capacity != 0)
                 this->_allocator.deallocate(this->_begin, this->_capacity);
         }
@@ -140,22 +197,35 @@ namespace ft {
                     this->_allocator.destroy(this->_begin + i);
                 this->_size = n;
             } else {
-                if (n > this->_capacity) {
-                    this->reserve(n);
-                    for (size_type i = this->_size; i < n; i++) {
-                        this->_allocator.construct(this->_begin + i, val);
-                        this->_size++;
-                    }
-                } else {
-                    this->reserve(this->_capacity);
-                    for (size_type i = this->_size; i < n; i++) {
-                        this->_allocator.construct(this->_begin + i, val);
-                        this->_size++;
-                    }
+                if (n > this->_capacity)
+                    this->reserve(grown_capacity(n - this->_size));
+                for (size_type i = this->_size; i < n; i++) {
+                    this->_allocator.construct(this->_begin + i, val);
+                    this->_size++;
                 }
             }
         }
 
+        void resize(size_type n, default_init_t) {
+            if (n <= this->_size) {
+                ops::destroy_range(this->_allocator, this->_begin + n, this->_begin + this->_size, trivial_tag());
+                this->_size = n;
+            } else {
+                this->append(n - this->_size, default_init);
+            }
+        }
+
+        // Adds n default-initialized elements at the end, growing at most
+        // once, and returns an iterator to the first of them; [it, end()) is
+        // the caller's to fill in.
+        iterator append(size_type n, default_init_t) {
+            if (n > this->_capacity - this->_size)
+                this->reserve(grown_capacity(n));
+            ops::default_construct(this->_allocator, this->_begin + this->_size, n);
+            this->_size += n;
+            return (this->end() - n);
+        }
+
         size_type capacity() const {
             return (this->_capacity);
         }
@@ -168,16 +238,11 @@ namespace ft {
         }
 
         void reserve(size_type n) {
-            if (n < this->_capacity)
+            if (n <= this->_capacity)
                 return;
-            pointer new_first = this->_allocator.allocate(n);
-            for (size_type i = 0; i < this->_size; i++)
-                this->_allocator.construct(new_first + i, *(this->_begin + i));
-            for (size_type i = 0; i < this->_size; i++)
-                this->_allocator.destroy(this->_begin + i);
-            this->_allocator.deallocate(this->_begin, this->_capacity);
-            this->_capacity = n;
-            this->_begin = new_first;
+            if (n > this->max_size())
+                throw std::length_error("vector");
+            relocate_around(this->_allocator.allocate(n), n, this->_size, 0);
         }
 
         reference operator[](size_type n) {
@@ -236,20 +301,34 @@ namespace ft {
         }
 
         void push_back(const value_type &x) {
-            if (this->_size >= this->_capacity)
-                reserve(this->_capacity == 0 ? 1 : this->_capacity * 2);
-
+            if (this->_size >= this->_capacity) {
+                // x may be one of our own elements; insert builds the copy
+                // before the old storage goes away.
+                insert(this->end(), x);
+                return;
+            }
             this->_allocator.construct(this->_begin + this->_size, x);
             this->_size++;
         }
+#if FT_HAS_MOVE
 
-        void pop_back() {
-            value_type tmp;
+        void push_back(value_type &&x) {
+            emplace_back(std::move(x));
+        }
 
-            tmp = this->back();
+        template<class... Args>
+        reference emplace_back(Args &&... args) {
+            if (this->_size >= this->_capacity)
+                return (*emplace(this->end(), std::forward<Args>(args)...));
+            this->_allocator.construct(this->_begin + this->_size, std::forward<Args>(args)...);
+            this->_size++;
+            return (this->back());
+        }
+#endif
+
+        void pop_back() {
             this->_allocator.destroy(this->_begin + this->_size - 1);
             this->_size -= 1;
-
         }
 
         iterator insert(iterator position, const value_type &val) {
@@ -257,94 +336,110 @@ namespace ft {
 				throw std::logic_error("vector");
             difference_type d_size = position - this->begin();
             if (this->_size == this->_capacity){
-                if (this->_capacity == 0)
-                    this->_capacity += 1;
-                this->_capacity *= 2;
-                pointer new_begin = this->_allocator.allocate(this->_capacity);
-                std::uninitialized_copy(this->begin(), position, iterator(new_begin));
-                this->_allocator.construct(new_begin + d_size, val);
-                std::uninitialized_copy(position, this->end(), iterator(new_begin + d_size + 1));
-                for (size_type i = 0; i < this->_size; i++)
-                    this->_allocator.destroy(this->_begin + i);
-                if (this->_size)
-                    this->_allocator.deallocate(this->_begin, this->_size);
+                size_type new_capacity = grown_capacity(1);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    this->_allocator.construct(new_begin + d_size, val);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
+                }
+                relocate_around(new_begin, new_capacity, d_size, 1);
+            }
+            else if (static_cast<size_type>(d_size) == this->_size)
+            {
+                this->_allocator.construct(this->_begin + this->_size, val);
                 this->_size += 1;
-                this->_begin = new_begin;
             }
             else
             {
-                for (size_type i = this->_size; i > static_cast<size_type>(d_size); i--)
-                {
-                    this->_allocator.destroy(this->_begin + i);
-                    this->_allocator.construct(this->_begin + i, *(this->_begin + i - 1));
+                value_type tmp(val);
+
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, 1, trivial_tag());
+                this->_allocator.construct(this->_begin + d_size, FT_MOVE(tmp));
+                this->_size += 1;
+            }
+            return (this->begin() + d_size);
+        }
+#if FT_HAS_MOVE
+
+        iterator insert(iterator position, value_type &&val) {
+            return (emplace(position, std::move(val)));
+        }
+
+        template<class... Args>
+        iterator emplace(iterator position, Args &&... args) {
+            size_type d_size = static_cast<size_type>(position - this->begin());
+
+            if (this->_size == this->_capacity) {
+                size_type new_capacity = grown_capacity(1);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    this->_allocator.construct(new_begin + d_size, std::forward<Args>(args)...);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
                 }
-                    this->_allocator.destroy(&(*position));
-                    this->_allocator.construct(&(*position), val);
-                    this->_size += 1;
+                relocate_around(new_begin, new_capacity, d_size, 1);
+            } else if (d_size == this->_size) {
+                this->_allocator.construct(this->_begin + this->_size, std::forward<Args>(args)...);
+                this->_size += 1;
+            } else {
+                value_type tmp(std::forward<Args>(args)...);
+
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, 1, trivial_tag());
+                this->_allocator.construct(this->_begin + d_size, std::move(tmp));
+                this->_size += 1;
             }
             return (this->begin() + d_size);
         }
+#endif
 
         void insert(iterator position, size_type n, const value_type &val) {
-            difference_type d_size = position - this->begin();
+            size_type d_size = static_cast<size_type>(position - this->begin());
+            if (n == 0)
+                return;
             if (this->_size + n > this->_capacity){
-                if (this->_capacity * 2 >= this->_size + n)
-                    this->_capacity *= 2;
-                else
-                    this->_size += n;
-                pointer new_begin = this->_allocator.allocate(this->_capacity);
-                std::uninitialized_copy(this->begin(), position, new_begin);
-                std::uninitialized_fill_n(new_begin + d_size, n, val);
-                std::uninitialized_copy(position, this->end(), new_begin + d_size + n);
-                for (size_type i = 0; i < this->_size; i++)
-                    this->_allocator.destroy(this->_begin + i);
-                this->_allocator.deallocate(this->_begin, this->_capacity);
-                this->_size += n;
-                this->_begin = new_begin;
+                size_type new_capacity = grown_capacity(n);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    std::uninitialized_fill_n(new_begin + d_size, n, val);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
+                }
+                relocate_around(new_begin, new_capacity, d_size, n);
             }
             else {
-                for (size_type i = this->_size; i > static_cast<size_type>(d_size); i--){
-                    this->_allocator.destroy(this->_begin + i + n - 1);
-                    this->_allocator.construct(this->_begin + i + n - 1, *(this->_begin + i - 1));
-                }
-                for (size_type i = 0; i < n; i++){
-                    this->_allocator.destroy(this->_begin + i + d_size);
-                    this->_allocator.construct(this->_begin + i + d_size, val);
-                }
-                    this->_size += n;
+                value_type tmp(val);
+
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, n, trivial_tag());
+                std::uninitialized_fill_n(this->_begin + d_size, n, tmp);
+                this->_size += n;
             }
         }
 
         template<class InputIterator>
         void insert(iterator position, InputIterator first, InputIterator last,
                     typename enable_if<!is_integral<InputIterator>::value>::type * = 0) {
-            difference_type d_size = position - this->begin();
+            size_type d_size = static_cast<size_type>(position - this->begin());
             size_type n = static_cast<size_type>(std::distance(first, last));
-            
+
+            if (n == 0)
+                return;
             if (this->_size + n > this->_capacity){
-                if (this->_capacity * 2 >= this->_size + n)
-                        this->_capacity *= 2;
-                    else
-                        this->_capacity = this->_size + n;
-                pointer new_begin = this->_allocator.allocate(this->_capacity);
-                std::uninitialized_copy(this->begin(), position, new_begin);
-                std::uninitialized_copy(first, last, new_begin + d_size);
-                std::uninitialized_copy(position, this->end(), new_begin + d_size + n);
-                
-                for (size_type i = 0; i < this->_size; i++)
-                    this->_allocator.destroy(this->_begin + i);
-                this->_allocator.deallocate(this->_begin, this->_capacity);
-                this->_size += n;
-                this->_begin = new_begin;
-            } else {
-                for (size_type i = this->_size; i > static_cast<size_type>(d_size); i--){
-                    this->_allocator.destroy(this->_begin + i + n - 1);
-                    this->_allocator.construct(this->_begin + i + n - 1, *(this->_begin + i - 1));
-                }
-                for (size_type i = 0; i < n; i++, this->_begin++){
-                    this->_allocator.destroy(this->_begin + i + n);
-                    this->_allocator.construct(this->_begin + + d_size + i, *this->_begin);
+                size_type new_capacity = grown_capacity(n);
+                pointer new_begin = this->_allocator.allocate(new_capacity);
+                try {
+                    std::uninitialized_copy(first, last, new_begin + d_size);
+                } catch (...) {
+                    this->_allocator.deallocate(new_begin, new_capacity);
+                    throw;
                 }
+                relocate_around(new_begin, new_capacity, d_size, n);
+            } else {
+                ops::open_gap(this->_allocator, this->_begin, this->_size, d_size, n, trivial_tag());
+                std::uninitialized_copy(first, last, this->_begin + d_size);
                 this->_size += n;
             }
         }
@@ -352,30 +447,19 @@ namespace ft {
         iterator erase(const_iterator position) {
             size_type d_size = static_cast<size_type>(position - this->begin());
 
-            for (size_type i = d_size; i < this->_size - 1; i++) {
-                this->_allocator.destroy(this->_begin + i);
-                this->_allocator.construct(this->_begin + i, *(this->_begin + i + 1));
-            }
+            ops::close_gap(this->_allocator, this->_begin, this->_size, d_size, 1, trivial_tag());
             this->_size--;
-            this->_allocator.destroy(this->_begin + this->_size - 1);
             return (this->begin() + d_size);
         }
 
         iterator erase(iterator first, iterator last) {
-            difference_type begin_to_first_size = first - this->begin();
-            difference_type first_to_last_size = last - first;
-            difference_type last_to_end_size = this->end() - last;
-
-            for (difference_type i = 0; i < first_to_last_size; i++) {
-                this->_allocator.destroy(this->_begin + begin_to_first_size + i);
-            }
-
-            for (difference_type i = 0; i < last_to_end_size; i++) {
-                this->_allocator.construct(this->_begin + begin_to_first_size + i,
-                                           *(this->_begin + begin_to_first_size + first_to_last_size + i));
-                this->_allocator.destroy(this->_begin + begin_to_first_size + first_to_last_size + i);
-            }
+            size_type begin_to_first_size = static_cast<size_type>(first - this->begin());
+            size_type first_to_last_size = static_cast<size_type>(last - first);
 
+            if (first_to_last_size == 0)
+                return (first);
+            ops::close_gap(this->_allocator, this->_begin, this->_size, begin_to_first_size, first_to_last_size,
+                           trivial_tag());
             this->_size -= first_to_last_size;
 
             return (first);
@@ -404,51 +488,86 @@ namespace ft {
         }
 
         void clear() {
-            for (size_type i = 0; i < this->_size; i++)
-                this->_allocator.destroy(this->_begin + i);
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
             this->_size = 0;
         }
 
         allocator_type get_allocator() const {
             return (this->_allocator);
         }
+
+    private:
+        // The capacity to reallocate to for n more elements.
+        size_type grown_capacity(size_type n) const {
+            if (n > this->max_size() - this->_size)
+                throw std::length_error("vector");
+            return (growth_policy::next_capacity(this->_capacity, this->_size + n, this->max_size(),
+                                                 sizeof(value_type)));
+        }
+
+        // Moves every element into new_begin around slots [pos, pos + n),
+        // which the caller has already filled, and frees the old storage.
+        // If an element throws, the gap and new_begin are released and the
+        // vector is left as it was.
+        void relocate_around(pointer new_begin, size_type new_capacity, size_type pos, size_type n) {
+            try {
+                ops::transfer(this->_allocator, new_begin, this->_begin, pos, trivial_tag());
+                try {
+                    ops::transfer(this->_allocator, new_begin + pos + n, this->_begin + pos, this->_size - pos,
+                                  trivial_tag());
+                } catch (...) {
+                    ops::destroy_range(this->_allocator, new_begin, new_begin + pos, trivial_tag());
+                    throw;
+                }
+            } catch (...) {
+                ops::destroy_range(this->_allocator, new_begin + pos, new_begin + pos + n, trivial_tag());
+                this->_allocator.deallocate(new_begin, new_capacity);
+                throw;
+            }
+            ops::destroy_range(this->_allocator, this->_begin, this->_begin + this->_size, trivial_tag());
+            if (this->_capacity != 0)
+                this->_allocator.deallocate(this->_begin, this->_capacity);
+            this->_begin = new_begin;
+            this->_capacity = new_capacity;
+            this->_size += n;
+        }
     };
 
-    template<class T, class Allocator>
-    bool operator==(const vector<T, Allocator> &x, const vector<T, Allocator> &y) {
+    template<class T, class Allocator, class Growth>
+    bool operator==(const vector<T, Allocator, Growth> &x, const vector<T, Allocator, Growth> &y) {
         if (x.size() != y.size())
             return (false);
-        return (equal(x.begin(), x.end(), y.begin()));
+        return (ft::equal(x.begin(), x.end(), y.begin()));
     }
 
-    template<class T, class Allocator>
-    bool operator<(const vector<T, Allocator> &x, const vector<T, Allocator> &y) {
+    template<class T, class Allocator, class Growth>
+    bool operator<(const vector<T, Allocator, Growth> &x, const vector<T, Allocator, Growth> &y) {
 
-        return (lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()));
+        return (ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()));
     }
 
-    template<class T, class Allocator>
-    bool operator!=(const vector<T, Allocator> &x, const vector<T, Allocator> &y) {
+    template<class T, class Allocator, class Growth>
+    bool operator!=(const vector<T, Allocator, Growth> &x, const vector<T, Allocator, Growth> &y) {
         return (!(x == y));
     }
 
-    template<class T, class Allocator>
-    bool operator>(const vector<T, Allocator> &x, const vector<T, Allocator> &y) {
-        return (lexicographical_compare(y.begin(), y.end(), x.begin(), x.end()));
+    template<class T, class Allocator, class Growth>
+    bool operator>(const vector<T, Allocator, Growth> &x, const vector<T, Allocator, Growth> &y) {
+        return (ft::lexicographical_compare(y.begin(), y.end(), x.begin(), x.end()));
     }
 
-    template<class T, class Allocator>
-    bool operator>=(const vector<T, Allocator> &x, const vector<T, Allocator> &y) {
+    template<class T, class Allocator, class Growth>
+    bool operator>=(const vector<T, Allocator, Growth> &x, const vector<T, Allocator, Growth> &y) {
         return (!(x < y));
     }
 
-    template<class T, class Allocator>
-    bool operator<=(const vector<T, Allocator> &x, const vector<T, Allocator> &y) {
+    template<class T, class Allocator, class Growth>
+    bool operator<=(const vector<T, Allocator, Growth> &x, const vector<T, Allocator, Growth> &y) {
         return (!(x > y));
     }
 
-    template<class T, class Alloc>
-    void swap(vector<T, Alloc> &x, vector<T, Alloc> &y) {
+    template<class T, class Alloc, class Growth>
+    void swap(vector<T, Alloc, Growth> &x, vector<T, Alloc, Growth> &y) {
         x.swap(y);
     }
 };
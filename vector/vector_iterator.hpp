@@ -26,6 +26,10 @@ namespace ft {
             this->_p = p;
         }
 
+        vector_iterator(const vector_iterator &copy) {
+            this->_p = copy.base();
+        }
+
         template<class Iter>
         vector_iterator(const vector_iterator<Iter> &it) {
             this->_p = it.base();
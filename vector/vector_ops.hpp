@@ -0,0 +1,144 @@
+#ifndef VECTOR_OPS
+#define VECTOR_OPS
+
+#include <cstring>
+#include <memory>
+#include <new>
+#include "../util/util.hpp"
+
+namespace ft {
+    // Passed to vector and small_vector to ask for default-initialized
+    // elements instead of copies of a value: types with a trivial default
+    // constructor, like main.cpp's Buffer, are then left uninitialized for
+    // the caller to overwrite, and the memory is touched only once.
+    struct default_init_t {
+    };
+
+    const default_init_t default_init = default_init_t();
+
+    // Element moves shared by vector and small_vector, on raw arrays owned
+    // through alloc. Each comes in two versions picked by trivial: memcpy /
+    // memmove, used when that is all T's copy constructor would do and the
+    // allocator is the default one, whose construct and destroy do nothing
+    // else; and an element-by-element one.
+    template<class T, class Allocator>
+    struct vector_ops {
+        typedef typename Allocator::pointer pointer;
+        typedef typename Allocator::const_pointer const_pointer;
+        typedef typename Allocator::size_type size_type;
+        typedef integral_constant<bool, is_trivially_copyable<T>::value
+                && is_same<Allocator, std::allocator<T> >::value> trivial;
+        typedef integral_constant<bool, is_same<Allocator, std::allocator<T> >::value> default_allocator;
+
+        static void destroy_range(Allocator &, pointer, pointer, true_type) {}
+
+        static void destroy_range(Allocator &alloc, pointer first, pointer last, false_type) {
+            for (; first != last; ++first)
+                alloc.destroy(first);
+        }
+
+        static void copy_construct(Allocator &, pointer dst, const_pointer src, size_type n, true_type) {
+            if (n != 0)
+                std::memcpy(static_cast<void *>(dst), static_cast<const void *>(src), n * sizeof(T));
+        }
+
+        static void copy_construct(Allocator &alloc, pointer dst, const_pointer src, size_type n, false_type) {
+            size_type i = 0;
+
+            try {
+                for (; i < n; i++)
+                    alloc.construct(dst + i, src[i]);
+            } catch (...) {
+                destroy_range(alloc, dst, dst + i, false_type());
+                throw;
+            }
+        }
+
+        // Default-initializes n elements at p. The default allocator's
+        // construct only copies, so placement new stands in for it; other
+        // allocators get copies of T(), which is value-initialization.
+        static void default_construct(Allocator &alloc, pointer p, size_type n) {
+            default_construct(alloc, p, n, default_allocator());
+        }
+
+        static void default_construct(Allocator &alloc, pointer p, size_type n, true_type) {
+            size_type i = 0;
+
+            try {
+                for (; i < n; i++)
+                    ::new (static_cast<void *>(p + i)) T;
+            } catch (...) {
+                destroy_range(alloc, p, p + i, false_type());
+                throw;
+            }
+        }
+
+        static void default_construct(Allocator &alloc, pointer p, size_type n, false_type) {
+            size_type i = 0;
+
+            try {
+                for (; i < n; i++)
+                    alloc.construct(p + i, T());
+            } catch (...) {
+                destroy_range(alloc, p, p + i, false_type());
+                throw;
+            }
+        }
+
+        // Builds n elements at dst from src, moving them only when that
+        // cannot throw, so src is intact if this throws.
+        static void transfer(Allocator &alloc, pointer dst, pointer src, size_type n, true_type) {
+            copy_construct(alloc, dst, src, n, true_type());
+        }
+
+        static void transfer(Allocator &alloc, pointer dst, pointer src, size_type n, false_type) {
+            size_type i = 0;
+
+            try {
+                for (; i < n; i++)
+                    alloc.construct(dst + i, FT_MOVE_IF_NOEXCEPT(src[i]));
+            } catch (...) {
+                destroy_range(alloc, dst, dst + i, false_type());
+                throw;
+            }
+        }
+
+        // Moves [pos, size) of begin up by n slots, leaving [pos, pos + n)
+        // raw for the caller to fill.
+        static void open_gap(Allocator &, pointer begin, size_type size, size_type pos, size_type n, true_type) {
+            if (pos != size)
+                std::memmove(static_cast<void *>(begin + pos + n), static_cast<const void *>(begin + pos),
+                             (size - pos) * sizeof(T));
+        }
+
+        // Slots past the old end are constructed, the rest assigned, so
+        // elements like strings keep reusing their buffers.
+        static void open_gap(Allocator &alloc, pointer begin, size_type size, size_type pos, size_type n,
+                             false_type) {
+            for (size_type i = size; i > pos; i--) {
+                if (i - 1 + n >= size)
+                    alloc.construct(begin + i - 1 + n, FT_MOVE(begin[i - 1]));
+                else
+                    begin[i - 1 + n] = FT_MOVE(begin[i - 1]);
+            }
+            destroy_range(alloc, begin + pos, begin + (pos + n < size ? pos + n : size), false_type());
+        }
+
+        // Erases [pos, pos + n) of begin by moving [pos + n, size) down over
+        // it and destroying the last n slots.
+        static void close_gap(Allocator &, pointer begin, size_type size, size_type pos, size_type n, true_type) {
+            if (pos + n != size)
+                std::memmove(static_cast<void *>(begin + pos), static_cast<const void *>(begin + pos + n),
+                             (size - pos - n) * sizeof(T));
+        }
+
+        static void close_gap(Allocator &alloc, pointer begin, size_type size, size_type pos, size_type n,
+                              false_type) {
+            for (size_type i = pos + n; i < size; i++)
+                begin[i - n] = FT_MOVE(begin[i]);
+            destroy_range(alloc, begin + size - n, begin + size, false_type());
+        }
+    };
+}
+
+#endif